@@ -1,3 +1,238 @@
+/* Worst single insert: the slowest individual insertion, in nanoseconds, within each measurement interval */
+/* Unlike the other benchmarks, this one is optional, so that drivers that do not define BENCH_INSERT_WORST and */
+/* map_n_insert_worst_result objects still compile */
+#ifdef BENCH_INSERT_WORST
+#define BENCHMARK_MAP_INSERT_WORST( n ) \
+  map_##n##_insert_worst_result.set_active_plot( MAP_ID ); \
+  \
+  if( BENCH_INSERT_WORST ) \
+  { \
+    MAP_##n##_INIT; \
+    std::this_thread::sleep_for( std::chrono::milliseconds( MS_WAIT_BETWEEN_BENCHMARKS ) ); \
+    \
+    unsigned long long worst = 0; \
+    \
+    for( size_t i = 0, j = 0; i < TOTAL_ELEMENTS; ) \
+    { \
+      std::chrono::time_point<std::chrono::high_resolution_clock> insert_start = \
+        std::chrono::high_resolution_clock::now(); \
+      \
+      MAP_##n##_INSERT( map_##n##_keys_for_insert[ i ], map_##n##_el_ty() ); \
+      \
+      unsigned long long time = std::chrono::duration_cast<std::chrono::nanoseconds>( \
+        std::chrono::high_resolution_clock::now() - insert_start \
+      ).count(); \
+      if( time > worst ) \
+        worst = time; \
+      \
+      ++i; \
+      if( ++j == MEASUREMENT_INTERVAL ) \
+      { \
+        map_##n##_insert_worst_result.record_time( run, i / MEASUREMENT_INTERVAL - 1, worst ); \
+        worst = 0; \
+        j = 0; \
+      } \
+    } \
+    \
+    MAP_##n##_CLEANUP; \
+  } \
+
+#else
+#define BENCHMARK_MAP_INSERT_WORST( n )
+#endif
+
+/* Peak footprint: the greatest number of bytes held by the map at any point within each measurement interval */
+/* The driver must define BENCH_FOOTPRINT_RESET and BENCH_FOOTPRINT_PEAK, which reset and return the peak allocated */
+/* bytes reported by an instrumented allocator (e.g. CC_REALLOC and CC_FREE redefined to count bytes) */
+#ifdef BENCH_PEAK_FOOTPRINT
+#define BENCHMARK_MAP_PEAK_FOOTPRINT( n ) \
+  map_##n##_peak_footprint_result.set_active_plot( MAP_ID ); \
+  \
+  if( BENCH_PEAK_FOOTPRINT ) \
+  { \
+    MAP_##n##_INIT; \
+    BENCH_FOOTPRINT_RESET; \
+    \
+    for( size_t i = 0, j = 0; i < TOTAL_ELEMENTS; ) \
+    { \
+      MAP_##n##_INSERT( map_##n##_keys_for_insert[ i ], map_##n##_el_ty() ); \
+      \
+      ++i; \
+      if( ++j == MEASUREMENT_INTERVAL ) \
+      { \
+        map_##n##_peak_footprint_result.record_time( run, i / MEASUREMENT_INTERVAL - 1, BENCH_FOOTPRINT_PEAK ); \
+        BENCH_FOOTPRINT_RESET; \
+        j = 0; \
+      } \
+    } \
+    \
+    MAP_##n##_CLEANUP; \
+  } \
+
+#else
+#define BENCHMARK_MAP_PEAK_FOOTPRINT( n )
+#endif
+
+/* Batched get existing: the same lookups as get existing, but resolved by a single MAP_n_GET_N( keys, count ) call */
+/* that returns the number of keys found (e.g. via CC's get_n, which prefetches the buckets of each batch of keys) */
+/* The gain over individual lookups shows up once TOTAL_ELEMENTS puts the map well beyond the last-level cache */
+#ifdef BENCH_GET_EXISTING_BATCHED
+#define BENCHMARK_MAP_GET_EXISTING_BATCHED_SET_PLOT( n ) \
+  map_##n##_get_existing_batched_result.set_active_plot( MAP_ID ); \
+
+#define BENCHMARK_MAP_GET_EXISTING_BATCHED( n ) \
+        if( BENCH_GET_EXISTING_BATCHED ) \
+        { \
+          std::decay<decltype( map_##n##_keys_for_insert[ 0 ] )>::type batch_keys[ 1000 ]; \
+          for( size_t k = 0, l = std::uniform_int_distribution<size_t>( 0, i - 1 )( rng ); k < 1000; ++k ) \
+          { \
+            batch_keys[ k ] = map_##n##_keys_for_insert[ l ]; \
+            if( ++l == i ) \
+              l = 0; \
+          } \
+          \
+          start = std::chrono::high_resolution_clock::now(); \
+          \
+          total += MAP_##n##_GET_N( batch_keys, 1000 ); \
+          \
+          map_##n##_get_existing_batched_result.record_time( \
+            run, \
+            i / MEASUREMENT_INTERVAL - 1, \
+            std::chrono::duration_cast<std::chrono::microseconds>( \
+              std::chrono::high_resolution_clock::now() - start \
+            ).count() \
+          ); \
+        } \
+
+#else
+#define BENCHMARK_MAP_GET_EXISTING_BATCHED_SET_PLOT( n )
+#define BENCHMARK_MAP_GET_EXISTING_BATCHED( n )
+#endif
+
+/* Get strided: lookups of existing keys that are all multiples of a large power of two (e.g. 4096-aligned addresses */
+/* or offsets), which pile up in a few buckets under hash functions whose low bits ignore the key's high bits */
+/* The driver must define MAP_n_STRIDED_KEY( i ), which returns the i-th such key (e.g. i * 4096 for integer keys) */
+#ifdef BENCH_GET_STRIDED
+#define BENCHMARK_MAP_GET_STRIDED( n ) \
+  map_##n##_get_strided_result.set_active_plot( MAP_ID ); \
+  \
+  if( BENCH_GET_STRIDED ) \
+  { \
+    MAP_##n##_INIT; \
+    std::this_thread::sleep_for( std::chrono::milliseconds( MS_WAIT_BETWEEN_BENCHMARKS ) ); \
+    \
+    volatile unsigned long long total = 0; \
+    \
+    for( size_t i = 0, j = 0; i < TOTAL_ELEMENTS; ) \
+    { \
+      MAP_##n##_INSERT( MAP_##n##_STRIDED_KEY( i ), map_##n##_el_ty() ); \
+      \
+      ++i; \
+      if( ++j == MEASUREMENT_INTERVAL ) \
+      { \
+        start = std::chrono::high_resolution_clock::now(); \
+        \
+        for( size_t k = 0, l = std::uniform_int_distribution<size_t>( 0, i - 1 )( rng ); k < 1000; ++k ) \
+        { \
+          total += MAP_##n##_GET( MAP_##n##_STRIDED_KEY( l ) ); \
+          if( ++l == i ) \
+            l = 0; \
+        } \
+        \
+        map_##n##_get_strided_result.record_time( \
+          run, \
+          i / MEASUREMENT_INTERVAL - 1, \
+          std::chrono::duration_cast<std::chrono::microseconds>( \
+            std::chrono::high_resolution_clock::now() - start \
+          ).count() \
+        ); \
+        \
+        j = 0; \
+      } \
+    } \
+    \
+    MAP_##n##_CLEANUP; \
+  } \
+
+#else
+#define BENCHMARK_MAP_GET_STRIDED( n )
+#endif
+
+/* Range scan: short in-order scans starting from random existing keys, resolved by a MAP_n_RANGE( key, count ) call */
+/* that visits the count elements whose keys follow key in ascending order and returns the number visited */
+/* An ordered map (e.g. CC's omap via lower_bound and next) answers each scan directly, whereas a hash map driver must */
+/* copy and sort its keys before scanning, so this plot shows the crossover between the two approaches */
+/* Point lookups in ordered maps are compared against hash maps by registering the ordered map as an ordinary driver */
+#ifdef BENCH_RANGE_SCAN
+#define BENCHMARK_MAP_RANGE_SCAN( n ) \
+  map_##n##_range_scan_result.set_active_plot( MAP_ID ); \
+  \
+  if( BENCH_RANGE_SCAN ) \
+  { \
+    MAP_##n##_INIT; \
+    std::this_thread::sleep_for( std::chrono::milliseconds( MS_WAIT_BETWEEN_BENCHMARKS ) ); \
+    \
+    volatile unsigned long long total = 0; \
+    \
+    for( size_t i = 0, j = 0; i < TOTAL_ELEMENTS; ) \
+    { \
+      MAP_##n##_INSERT( map_##n##_keys_for_insert[ i ], map_##n##_el_ty() ); \
+      \
+      ++i; \
+      if( ++j == MEASUREMENT_INTERVAL ) \
+      { \
+        start = std::chrono::high_resolution_clock::now(); \
+        \
+        for( size_t k = 0; k < 100; ++k ) \
+          total += MAP_##n##_RANGE( \
+            map_##n##_keys_for_insert[ std::uniform_int_distribution<size_t>( 0, i - 1 )( rng ) ], \
+            100 \
+          ); \
+        \
+        map_##n##_range_scan_result.record_time( \
+          run, \
+          i / MEASUREMENT_INTERVAL - 1, \
+          std::chrono::duration_cast<std::chrono::microseconds>( \
+            std::chrono::high_resolution_clock::now() - start \
+          ).count() \
+        ); \
+        \
+        j = 0; \
+      } \
+    } \
+    \
+    MAP_##n##_CLEANUP; \
+  } \
+
+#else
+#define BENCHMARK_MAP_RANGE_SCAN( n )
+#endif
+
+/* Iteration: a full pass over every element, via a MAP_n_ITERATE() call that visits each element through the */
+/* container's iteration API (e.g. CC's for_each) and returns a value accumulated from them, at each measurement */
+/* The map's capacity is typically several times its size just after growth, so containers that scan buckets rather */
+/* than packed elements (e.g. CC's map, as opposed to its dmap) pay for the empty buckets as well */
+#ifdef BENCH_ITERATION
+#define BENCHMARK_MAP_ITERATION( n ) \
+        if( BENCH_ITERATION ) \
+        { \
+          start = std::chrono::high_resolution_clock::now(); \
+          \
+          total += MAP_##n##_ITERATE(); \
+          \
+          map_##n##_iteration_result.record_time( \
+            run, \
+            i / MEASUREMENT_INTERVAL - 1, \
+            std::chrono::duration_cast<std::chrono::microseconds>( \
+              std::chrono::high_resolution_clock::now() - start \
+            ).count() \
+          ); \
+        } \
+
+#else
+#define BENCHMARK_MAP_ITERATION( n )
+#endif
+
 #define BENCHMARK_MAP( n ) \
 { \
   map_##n##_insert_nonexisting_result.set_active_plot( MAP_ID ); \
@@ -7,6 +242,7 @@
   map_##n##_get_existing_result.set_active_plot( MAP_ID ); \
   map_##n##_get_nonexisting_result.set_active_plot( MAP_ID ); \
   map_##n##_iteration_result.set_active_plot( MAP_ID ); \
+  BENCHMARK_MAP_GET_EXISTING_BATCHED_SET_PLOT( n ) \
   \
   std::chrono::time_point<std::chrono::high_resolution_clock> start; \
   \
@@ -39,6 +275,14 @@
     MAP_##n##_CLEANUP; \
   } \
   \
+  BENCHMARK_MAP_INSERT_WORST( n ) \
+  \
+  BENCHMARK_MAP_PEAK_FOOTPRINT( n ) \
+  \
+  BENCHMARK_MAP_GET_STRIDED( n ) \
+  \
+  BENCHMARK_MAP_RANGE_SCAN( n ) \
+  \
   /* Erase existing */ \
   if( BENCH_ERASE_EXISTING ){ \
     MAP_##n##_INIT; \
@@ -142,6 +386,8 @@
           ); \
         } \
         \
+        BENCHMARK_MAP_GET_EXISTING_BATCHED( n ) \
+        \
         /* Get non-existing */ \
         if( BENCH_GET_NONEXISTING ) \
         { \
@@ -184,6 +430,8 @@
             ).count() \
           ); \
         } \
+        \
+        BENCHMARK_MAP_ITERATION( n ) \
       } \
     } \
     \
@@ -197,23 +445,162 @@ BENCHMARK_MAP( 1 );
 BENCHMARK_MAP( 2 );
 BENCHMARK_MAP( 3 );
 
+/* Optional large-element map (e.g. for comparing the default and CC_SOA bucket layouts) */
+#ifdef MAP_4_INIT
+BENCHMARK_MAP( 4 );
+#endif
+
+/* Hash string: the time, in nanoseconds, to hash 1000 NULL-terminated strings of each length from 1 to 1024 bytes, */
+/* doubling at each step, via the driver's MAP_HASH_STRING( str, len ) (e.g. CC's default char * hash function) */
+/* Short, medium, and long keys land at the start, middle, and end of the plot's x-axis, respectively */
+#ifdef BENCH_HASH_STRING
+hash_string_result.set_active_plot( MAP_ID );
+
+if( BENCH_HASH_STRING )
+{
+  volatile size_t total = 0;
+
+  for( size_t len = 1, k = 0; len <= 1024; len *= 2, ++k )
+  {
+    std::string strs[ 64 ];
+    for( size_t i = 0; i < 64; ++i )
+      for( size_t j = 0; j < len; ++j )
+        strs[ i ] += (char)std::uniform_int_distribution<int>( 'a', 'z' )( rng );
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start = std::chrono::high_resolution_clock::now();
+
+    for( size_t i = 0; i < 1000; ++i )
+      total += MAP_HASH_STRING( strs[ i % 64 ].c_str(), len );
+
+    hash_string_result.record_time(
+      run,
+      k,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start
+      ).count()
+    );
+  }
+}
+#endif
+
+/* Insert large: the time, in microseconds, to get-or-insert TOTAL_ELEMENTS large records (e.g. 512 bytes) keyed by */
+/* map 1's keys via the driver's MAP_LARGE_INSERT( key, i ), which must construct the record from i if the key is new */
+/* Every key is used twice, so half the calls find an existing key */
+/* CC drivers can register this benchmark twice, once with get_or_insert, which builds a record for every call and */
+/* copies it twice on its way into the map, and once with get_or_insert_uninit, which constructs new records in place */
+#ifdef BENCH_INSERT_LARGE
+insert_large_result.set_active_plot( MAP_ID );
+
+if( BENCH_INSERT_LARGE )
+{
+  MAP_LARGE_INIT;
+  std::this_thread::sleep_for( std::chrono::milliseconds( MS_WAIT_BETWEEN_BENCHMARKS ) );
+
+  std::chrono::time_point<std::chrono::high_resolution_clock> start = std::chrono::high_resolution_clock::now();
+
+  for( size_t i = 0, j = 0; i < TOTAL_ELEMENTS; )
+  {
+    MAP_LARGE_INSERT( map_1_keys_for_insert[ i / 2 ], i );
+
+    ++i;
+    if( ++j == MEASUREMENT_INTERVAL )
+    {
+      insert_large_result.record_time(
+        run,
+        i / MEASUREMENT_INTERVAL - 1,
+        std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::high_resolution_clock::now() - start
+        ).count()
+      );
+      j = 0;
+    }
+  }
+
+  MAP_LARGE_CLEANUP;
+}
+#endif
+
+/* Sort: the time, in nanoseconds per element, to sort random uint64_t values, with 1000 elements at the first point */
+/* on the plot's x-axis and ten times as many at each later point, up to BENCH_SORT_MAX_ELEMENTS (e.g. 100000000) */
+/* The driver copies the values into its container via MAP_SORT_INIT( els, n ), which is not timed, and then sorts */
+/* them via MAP_SORT and releases them via MAP_SORT_CLEANUP (e.g. CC's cc_sort, whose radix sort handles fundamental */
+/* integer types, against qsort and std::sort on an array) */
+#ifdef BENCH_SORT
+sort_result.set_active_plot( MAP_ID );
+
+if( BENCH_SORT )
+{
+  for( size_t n = 1000, k = 0; n <= BENCH_SORT_MAX_ELEMENTS; n *= 10, ++k )
+  {
+    std::vector<uint64_t> els( n );
+    for( size_t i = 0; i < n; ++i )
+      els[ i ] = std::uniform_int_distribution<uint64_t>()( rng );
+
+    MAP_SORT_INIT( els.data(), n );
+    std::this_thread::sleep_for( std::chrono::milliseconds( MS_WAIT_BETWEEN_BENCHMARKS ) );
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start = std::chrono::high_resolution_clock::now();
+
+    MAP_SORT;
+
+    sort_result.record_time(
+      run,
+      k,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start
+      ).count() / n
+    );
+
+    MAP_SORT_CLEANUP;
+  }
+}
+#endif
+
 #undef MAP_ID
 #undef MAP_COLOR
 #undef MAP_1_INIT
 #undef MAP_2_INIT
 #undef MAP_3_INIT
+#undef MAP_4_INIT
 #undef MAP_1_INSERT
 #undef MAP_2_INSERT
 #undef MAP_3_INSERT
+#undef MAP_4_INSERT
 #undef MAP_1_GET
 #undef MAP_2_GET
 #undef MAP_3_GET
+#undef MAP_4_GET
+#undef MAP_1_GET_N
+#undef MAP_2_GET_N
+#undef MAP_3_GET_N
+#undef MAP_4_GET_N
+#undef MAP_1_STRIDED_KEY
+#undef MAP_2_STRIDED_KEY
+#undef MAP_3_STRIDED_KEY
+#undef MAP_4_STRIDED_KEY
+#undef MAP_1_ITERATE
+#undef MAP_2_ITERATE
+#undef MAP_3_ITERATE
+#undef MAP_4_ITERATE
+#undef MAP_1_RANGE
+#undef MAP_2_RANGE
+#undef MAP_3_RANGE
+#undef MAP_4_RANGE
+#undef MAP_HASH_STRING
+#undef MAP_LARGE_INIT
+#undef MAP_LARGE_INSERT
+#undef MAP_LARGE_CLEANUP
+#undef MAP_SORT_INIT
+#undef MAP_SORT
+#undef MAP_SORT_CLEANUP
 #undef MAP_1_ERASE
 #undef MAP_2_ERASE
 #undef MAP_3_ERASE
+#undef MAP_4_ERASE
 #undef MAP_1_CLEANUP
 #undef MAP_2_CLEANUP
 #undef MAP_3_CLEANUP
+#undef MAP_4_CLEANUP
 
 /*
 
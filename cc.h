@@ -1,6 +1,7 @@
 /*----------------------------------------- CC: CONVENIENT CONTAINERS v1.0.3 -------------------------------------------
 
-This library provides usability-oriented generic containers (vectors, linked lists, unordered maps, and unordered sets).
+This library provides usability-oriented generic containers (vectors, linked lists, unordered maps, unordered sets,
+ordered maps, ordered sets, and dense maps).
 
 Features:
 
@@ -27,6 +28,58 @@ Tested with GCC, MinGW, and Clang.
     #define CC_NO_SHORT_NAMES
       By default, CC exposes API macros without the "cc_" prefix.
       Define this flag to withhold the unprefixed names.
+      In C++, the unprefixed lower_bound and upper_bound clash with the standard library functions of the same names,
+      so either #include <algorithm> and any other standard headers before cc.h and avoid calling std::lower_bound and
+      std::upper_bound, or define this flag.
+
+    #define CC_NO_ALWAYS_INLINE
+      By default, in GCC and Clang, CC forces the inlining of map and set lookup, insertion, and erasure functions so
+      that each call site gets a probe loop specialized for its key type, with the hash and comparison functions
+      inlined. Define this flag to leave inlining decisions to the compiler, which reduces code size.
+
+    #define CC_NO_WORD_SCAN
+      By default, on little-endian platforms, the in-built char * hash function scans strings eight bytes at a time,
+      which may read up to seven bytes past a string's NULL terminator (though never across a page boundary).
+      Define this flag to hash strings without reading past their terminators, e.g. under memory checkers such as
+      Valgrind. The flag is defined automatically under AddressSanitizer and MemorySanitizer.
+
+    #define CC_SMALL_PROBELEN
+      By default, maps and sets store each bucket's probe length as an unsigned int. Define this flag to store it as an
+      unsigned char instead, which shrinks buckets whose key and element alignment is smaller than that of unsigned int
+      and, combined with the CC_SOA flag, allows e.g. a set( int ) to use five bytes per bucket instead of eight.
+      Probe lengths are then capped at 254. An insertion that finds the table at that cap first doubles its capacity
+      (up to four times) and rehashes it; if the cap still cannot be respected, as can happen when hundreds of keys
+      share the same hash, the insertion fails as if an allocation had failed. A shrink that would exceed the cap also
+      fails and leaves the map or set unchanged.
+      This flag changes the memory layout of maps and sets, so it must be defined consistently in all files that share
+      them.
+
+    #define CC_USABLE_SIZE( ptr ) malloc_usable_size( ptr )
+      By default, a vector's capacity is exactly the number of elements for which it requested memory.
+      Define this macro as a function-like macro returning the number of bytes actually usable in the block of memory
+      pointed to by ptr (e.g. glibc's malloc_usable_size or macOS's malloc_size) to have vectors also count, as part of
+      their capacity, any extra elements that fit in the slack that the allocator rounds each request up to.
+      The function must match the realloc function in use (see CC_REALLOC) and must be declared before cc.h is
+      #included.
+
+    #define CC_VEC_VM_THRESHOLD 67108864
+      By default, vectors obtain their memory from realloc, which may copy all elements whenever a vector grows.
+      Define this macro as a size in bytes to have vectors whose memory reaches that size instead reserve a large range
+      of address space via an anonymous mmap mapping (POSIX only) whose pages the operating system commits as they are
+      first written. Such a vector then grows in place, without copying its elements or moving them in memory, until
+      its reservation is exhausted, at which point the reservation is enlarged (via mremap, which moves pages without
+      copying them, on Linux when it is declared, e.g. with _GNU_SOURCE, or otherwise via copying).
+      Shrinking such a vector releases its excess pages in place, and shrinking it below the threshold moves it back
+      into memory from realloc.
+      The threshold should be large (e.g. several megabytes), since each reserved vector occupies at least one
+      mapping.
+      This macro requires MAP_ANONYMOUS, which glibc declares only if e.g. _DEFAULT_SOURCE is defined. It determines
+      how vector memory is freed, so it must be defined consistently in all files that share vectors.
+
+    #define CC_VEC_VM_RESERVE 68719476736
+      Sets the number of bytes of address space reserved for each vector that reaches CC_VEC_VM_THRESHOLD.
+      By default, the reservation is 64 GiB on 64-bit platforms and 256 MiB otherwise. If the operating system refuses
+      a reservation of that size, only the memory that the vector currently needs is reserved.
 
   The following can be #defined anywhere and affect all calls to API macros where the definition is visible:
   
@@ -93,6 +146,18 @@ API:
 
       Declares an uninitialized vector named cntr.
 
+    svec( el_ty, n ) cntr
+
+      Declares an uninitialized small vector named cntr.
+      A small vector is a vector whose first allocation is exactly large enough for n elements, regardless of the growth
+      policy of el_ty (see CC_GROWTH), and whose capacity never shrinks automatically below n (see CC_MIN_LOAD).
+      Because a vector's size and capacity are stored in the same allocation as its elements, a small vector that never
+      exceeds n elements costs a single allocation, and reading it typically costs a single cache miss.
+      Once it grows beyond n elements, it grows according to the growth policy of el_ty.
+      n should be a compile-time constant.
+      All API macros that accept a vector also accept a small vector, but svec( el_ty, n ) and vec( el_ty ) are distinct
+      types.
+
     size_t cap( vec( el_ty ) *cntr )
 
       Returns the current capacity.
@@ -128,11 +193,24 @@ API:
       Inserts n elements from array els at the end of the vector.
       Returns a pointer-iterator to the first new element, or NULL in the case of memory allocation failure.
 
+    el_ty *push_uninit( vec( el_ty ) *cntr )
+
+      Inserts an uninitialized element at the end of the vector.
+      Returns a pointer-iterator to the new element, which the caller must construct in place, or NULL in the case of
+      memory allocation failure.
+      Unlike push, this call avoids copying the element, which matters for large element types.
+
     el_ty *insert( vec( el_ty ) *cntr, size_t i, el_ty el )
 
       Inserts el at index i.
       Returns a pointer-iterator to the new element, or NULL in the case of memory allocation failure.
 
+    el_ty *insert_uninit( vec( el_ty ) *cntr, size_t i )
+
+      Inserts an uninitialized element at index i.
+      Returns a pointer-iterator to the new element, which the caller must construct in place, or NULL in the case of
+      memory allocation failure.
+
     el_ty *insert_n( vec( el_ty ) *cntr, size_t i, el_ty *els, size_t n )
 
       Inserts n elements from array els at index i.
@@ -151,6 +229,48 @@ API:
       Returns a pointer-iterator to the element after the erased elements, or an end pointer-iterator if there is no
       subsequent element.
 
+    el_ty *erase_swap( vec( el_ty ) *cntr, size_t i )
+
+      Erases the element at index i, calling the element type's destructor if it exists, and moves the last element
+      into its place.
+      Unlike erase, this call takes constant time, but it does not preserve the order of the remaining elements.
+      Returns a pointer-iterator to the element now at index i, or an end pointer-iterator if there is no such element.
+
+    el_ty *erase_swap_n( vec( el_ty ) *cntr, size_t i, size_t n )
+
+      Erases n elements beginning at index i, calling the element type's destructor, if it exists, for each erased
+      element, and moves the last n elements (or all the subsequent elements, if there are fewer) into their place.
+      Unlike erase_n, this call's cost is proportional to n rather than to the number of subsequent elements, but it
+      does not preserve the order of the remaining elements.
+      Returns a pointer-iterator to the element now at index i, or an end pointer-iterator if there is no such element.
+
+    size_t erase_if( vec( el_ty ) *cntr, bool ( *pred )( el_ty *el ) )
+
+      Erases every element for which pred returns true, calling the element type's destructor, if it exists, for each
+      erased element.
+      The order of the remaining elements is preserved.
+      The remaining elements are compacted in a single pass, so this call is much faster than erasing the elements
+      individually via erase.
+      Returns the number of elements erased.
+
+    void cc_sort( vec( el_ty ) *cntr )
+
+      Sorts the elements in ascending order according to the element type's comparison function.
+      If the element type is a fundamental integer type without a user-defined comparison function (see CC_CMPR below),
+      the elements are radix sorted, which requires a scratch buffer the size of the elements.
+      Otherwise, or if allocating that buffer fails, they are sorted in place via introsort.
+      The order of equal elements is not preserved.
+      This call has no unprefixed name, as sort would clash with C++'s <algorithm>.
+
+    bool cc_stable_sort( vec( el_ty ) *cntr )
+
+      Sorts the elements in ascending order according to the element type's comparison function, preserving the order
+      of equal elements.
+      Elements of types other than the fundamental integer types described under cc_sort are merge sorted, which
+      requires a scratch buffer the size of the elements.
+      Returns true, or false if unsuccessful due to memory allocation failure (in which case the vector is unchanged).
+      This call has no unprefixed name, as stable_sort would clash with C++'s <algorithm>.
+
     el_ty *end( vec( el_ty ) *cntr )
 
       Returns an end pointer-iterator.
@@ -174,6 +294,11 @@ API:
 
     Notes:
     - Vector pointer-iterators (including end) are invalidated by any API calls that cause memory reallocation.
+      If a min load factor is defined for the element type (see CC_MIN_LOAD below), these include erase, erase_n,
+      erase_swap, erase_swap_n, and erase_if.
+      If CC_VEC_VM_THRESHOLD is defined, then memory reallocation does not invalidate pointer-iterators to the elements
+      of a vector whose memory had already reached the threshold and still does, as long as the vector does not grow
+      beyond its reservation (see CC_VEC_VM_RESERVE).
 
   List (a doubly linked list with sentinels):
 
@@ -186,12 +311,25 @@ API:
       Inserts el before pointer-iterator i.
       Returns a pointer-iterator to the new element, or NULL in the case of memory allocation failure.
 
+    el_ty *insert_uninit( list( el_ty ) *cntr, el_ty *i )
+
+      Inserts an uninitialized element before pointer-iterator i.
+      Returns a pointer-iterator to the new element, which the caller must construct in place, or NULL in the case of
+      memory allocation failure.
+
     el_ty *push( list( el_ty ) *cntr, el_ty el )
 
       Inserts el at the end of the list.
       Returns a pointer-iterator to the new element, or NULL in the case of memory allocation failure.
       This call is synonymous with insert( cntr, end( cntr ), el ).
 
+    el_ty *push_uninit( list( el_ty ) *cntr )
+
+      Inserts an uninitialized element at the end of the list.
+      Returns a pointer-iterator to the new element, which the caller must construct in place, or NULL in the case of
+      memory allocation failure.
+      This call is synonymous with insert_uninit( cntr, end( cntr ) ).
+
     el_ty *erase( list( el_ty ) *cntr, el_ty *i )
 
       Erases element pointed to by pointer-iterator i, calling the element type's destructor if it exists.
@@ -273,6 +411,21 @@ API:
       Shrinks the capacity to best accommodate the current size.
       Returns true, or false if unsuccessful due to memory allocation failure.
 
+    cc_stats_ty stats( map( key_ty, el_ty ) *cntr )
+
+      Returns a cc_stats_ty struct describing the map's memory usage and probe lengths.
+      The struct contains the following members:
+        size_t size, cap         The current size and capacity.
+        double max_load          The max load factor associated with the key type.
+        size_t bytes             The number of bytes allocated, including any old storage still being migrated.
+        double mean_probelen     The mean probe length of the elements, where an element in its home bucket has a
+                                 probe length of one.
+        size_t max_probelen      The longest probe length of any element.
+        size_t probelen_histogram[ CC_PROBELEN_HISTOGRAM_SIZE ]
+                                 The number of elements with each probe length, where element i counts the elements
+                                 with a probe length of i + 1 and the last element also counts any longer probe lengths.
+      This function visits every bucket, so its cost is proportional to the capacity.
+
     el_ty *insert( map( key_ty, el_ty ) *cntr, key_ty key, el_ty el )
 
       Inserts element el with the specified key.
@@ -281,10 +434,37 @@ API:
       If adding one element would violate the map's max load factor, failure can occur even if it already contains the
       key.
 
+    el_ty *insert_uninit( map( key_ty, el_ty ) *cntr, key_ty key )
+
+      Inserts an uninitialized element with the specified key.
+      If an element with the same key already exists, the existing element is destroyed (via the element type's
+      destructor, if it exists) and left uninitialized in its place.
+      Returns a pointer-iterator to the element, which the caller must construct in place, or NULL in the case of memory
+      allocation failure.
+      If adding one element would violate the map's max load factor, failure can occur even if it already contains the
+      key.
+
     el_ty *get( map( key_ty, el_ty ) *cntr, key_ty key )
 
       Returns a pointer-iterator to the element with the specified key, or NULL if no such element exists.
 
+    size_t get_n( map( key_ty, el_ty ) *cntr, key_ty *keys, size_t n, el_ty **out )
+
+      Looks up the n keys in array keys and writes a pointer-iterator to each corresponding element, or NULL if no such
+      element exists, into array out.
+      The keys are hashed, and their buckets prefetched, in batches ahead of the lookups so that cache misses for
+      different keys overlap.
+      Returns the number of keys found.
+
+    bool insert_keys( map( key_ty, el_ty ) *cntr, key_ty *keys, el_ty *els, size_t n )
+
+      Inserts the n elements in array els with the corresponding keys in array keys, replacing any existing elements
+      with the same keys.
+      The capacity is first increased to accommodate n additional elements, so failure can occur even if the map
+      already contains all the keys.
+      Large batches are placed in the order of their home buckets, so this is the fastest way to build a large map.
+      Returns true, or false if unsuccessful due to memory allocation failure (in which case no elements are inserted).
+
     el_ty *get_or_insert( map( key_ty, el_ty ) *cntr, key_ty key, el_ty el )
 
       Inserts element el if no element with the specified key already exist.
@@ -294,6 +474,17 @@ API:
       key.
       Determine whether an element was inserted by comparing the map's size before and after the call.
 
+    el_ty *get_or_insert_uninit( map( key_ty, el_ty ) *cntr, key_ty key, bool *inserted )
+
+      Inserts an uninitialized element if no element with the specified key already exists.
+      Sets *inserted to true if the element was inserted, in which case the caller must construct it in place, or false
+      otherwise.
+      Returns a pointer-iterator to the new or existing element, or NULL in the case of memory allocation failure.
+      If adding one element would violate the map's max load factor, failure can occur even if it already contains the
+      key.
+      Unlike get_or_insert, this call never constructs or copies an element that is discarded because the key already
+      exists.
+
     const key_ty *key_for( map( key_ty, el_ty ) *cntr, el_ty *i )
 
       Returns a const pointer to the key for the element pointed to by pointer-iterator i.
@@ -303,10 +494,37 @@ API:
       Erases the element with the specified key, if it exists.
       Returns true if an element was erased, or false if no such element exists.
 
+    size_t erase_keys( map( key_ty, el_ty ) *cntr, key_ty *keys, size_t n )
+
+      Erases the elements with the n keys in array keys, where they exist.
+      Returns the number of elements erased.
+
+    size_t hash_of( map( key_ty, el_ty ) *cntr, key_ty key )
+
+      Returns the hash of key, as computed by the hash function associated with the map's key type.
+
+    el_ty *insert_with_hash( map( key_ty, el_ty ) *cntr, key_ty key, el_ty el, size_t hash )
+    el_ty *get_or_insert_with_hash( map( key_ty, el_ty ) *cntr, key_ty key, el_ty el, size_t hash )
+    el_ty *get_with_hash( map( key_ty, el_ty ) *cntr, key_ty key, size_t hash )
+    bool erase_with_hash( map( key_ty, el_ty ) *cntr, key_ty key, size_t hash )
+
+      Equivalent to insert, get_or_insert, get, and erase, except that the key's hash is supplied by the caller instead
+      of being computed.
+      hash must be the value returned by hash_of for the same key (possibly called on a different map or set with the
+      same key type).
+      This allows a key to be hashed once and then used with multiple maps and sets.
+
     void erase_itr( map( key_ty, el_ty ) *cntr, el_ty *i )
 
       Erases the element pointed to by pointer-iterator i.
 
+    size_t erase_if( map( key_ty, el_ty ) *cntr, bool ( *pred )( const key_ty *key, el_ty *el ) )
+
+      Erases every element for which pred returns true, calling the key and element types' destructors if they exist.
+      All elements are visited exactly once, in a single pass over the map's memory, so this is much faster than
+      erasing matching elements individually via erase_itr inside a for_each loop.
+      Returns the number of elements erased.
+
     el_ty *first( map( key_ty, el_ty ) *cntr )
 
       Returns a pointer-iterator to the first element, or an end pointer-iterator if the map is empty.
@@ -362,6 +580,11 @@ API:
     Notes:
     - Map pointer-iterators (including r_end and end) may be invalidated by any API calls that cause memory
       reallocation.
+      If a min load factor is defined for the key type (see CC_MIN_LOAD below), these include erase, erase_with_hash,
+      erase_keys, and erase_if, but not erase_itr.
+      If the key type has the CC_INCREMENTAL flag (see CC_FLAGS below), erase, erase_with_hash, and erase_keys may
+      also invalidate pointer-iterators while a migration is in progress, because they move elements from the old
+      storage to the new and free the old storage once the migration completes.
 
   Set (Robin Hood hash table for elements without a separate key):
 
@@ -389,6 +612,11 @@ API:
       Shrinks the capacity to best accommodate the current size.
       Returns true, or false if unsuccessful due to memory allocation failure.
 
+    cc_stats_ty stats( set( el_ty ) *cntr )
+
+      Returns a cc_stats_ty struct describing the set's memory usage and probe lengths (see the map documentation
+      above).
+
     el_ty *insert( set( el_ty ) *cntr, el_ty el )
 
       Inserts element el.
@@ -401,6 +629,22 @@ API:
 
       Returns a pointer-iterator to element el, or NULL if no such element exists.
 
+    size_t get_n( set( el_ty ) *cntr, el_ty *els, size_t n, el_ty **out )
+
+      Looks up the n elements in array els and writes a pointer-iterator to each, or NULL if it does not exist, into
+      array out.
+      The elements are hashed, and their buckets prefetched, in batches ahead of the lookups so that cache misses for
+      different elements overlap.
+      Returns the number of elements found.
+
+    bool insert_keys( set( el_ty ) *cntr, el_ty *els, size_t n )
+
+      Inserts the n elements in array els, replacing any existing elements.
+      The capacity is first increased to accommodate n additional elements, so failure can occur even if the set
+      already contains all the elements.
+      Large batches are placed in the order of their home buckets, so this is the fastest way to build a large set.
+      Returns true, or false if unsuccessful due to memory allocation failure (in which case no elements are inserted).
+
     el_ty *get_or_insert( set( el_ty ) *cntr, el_ty el )
 
       Inserts element el if it does not already exist.
@@ -415,6 +659,32 @@ API:
       Erases the element el, if it exists.
       Returns true if an element was erased, or false if no such element exists.
 
+    size_t erase_keys( set( el_ty ) *cntr, el_ty *els, size_t n )
+
+      Erases the n elements in array els, where they exist.
+      Returns the number of elements erased.
+
+    size_t hash_of( set( el_ty ) *cntr, el_ty el )
+
+      Returns the hash of el, as computed by the hash function associated with the set's element type.
+
+    el_ty *insert_with_hash( set( el_ty ) *cntr, el_ty el, size_t hash )
+    el_ty *get_or_insert_with_hash( set( el_ty ) *cntr, el_ty el, size_t hash )
+    el_ty *get_with_hash( set( el_ty ) *cntr, el_ty el, size_t hash )
+    bool erase_with_hash( set( el_ty ) *cntr, el_ty el, size_t hash )
+
+      Equivalent to insert, get_or_insert, get, and erase, except that the element's hash is supplied by the caller
+      instead of being computed.
+      hash must be the value returned by hash_of for the same element (possibly called on a different map or set with
+      the same key type).
+      This allows an element to be hashed once and then used with multiple maps and sets.
+
+    size_t erase_if( set( el_ty ) *cntr, bool ( *pred )( const el_ty *el ) )
+
+      Erases every element for which pred returns true, calling the element type's destructor if it exists.
+      All elements are visited exactly once, in a single pass over the set's memory.
+      Returns the number of elements erased.
+
     el_ty *first( set( el_ty ) *cntr )
 
       Returns a pointer-iterator to the first element, or an end pointer-iterator if the set is empty.
@@ -456,2385 +726,8069 @@ API:
     Notes:
     - Set pointer-iterators (including r_end and end) may be invalidated by any API calls that cause memory
       reallocation.
+      If a min load factor is defined for the element type (see CC_MIN_LOAD below), these include erase,
+      erase_with_hash, erase_keys, and erase_if, but not erase_itr.
+      If the element type has the CC_INCREMENTAL flag (see CC_FLAGS below), erase, erase_with_hash, and erase_keys may
+      also invalidate pointer-iterators while a migration is in progress, because they move elements from the old
+      storage to the new and free the old storage once the migration completes.
 
-  Destructor, comparison, and hash functions and custom max load factors:
+  Ordered map (a container associating elements with keys in ascending key order, implemented as a B-tree):
 
-    This part of the API allows the user to define custom destructor, comparison, and hash functions and max load
-    factors for a type.
-    Once these functions are defined, any container using that type for its elements or keys will call them
-    automatically.
-    Once the max load factor is defined, any map using the type for its key and any set using the type for its elements
-    will use the defined load factor to determine when rehashing is necessary.
+    omap( key_ty, el_ty ) cntr
 
-    #define CC_DTOR ty, { function body }
-    #include "cc.h"
+      Declares an uninitialized ordered map named cntr.
+      key_ty must be a type, or alias for a type, for which a comparison function has been defined.
+      This requirement is enforced internally such that neglecting it causes a compiler error.
+      For types with in-built comparison functions, and for details on how to declare new comparison functions, see
+      "Destructor, comparison, and hash functions and custom max load factors" below.
+      All nodes live in a single pool allocation, and each node holds as many keys and elements as fit in roughly 512
+      bytes, so that a lookup touches only a few cache lines per level of the tree.
 
-      Defines a destructor for type ty.
-      The signature of the function is void ( ty val ).
+    el_ty *insert( omap( key_ty, el_ty ) *cntr, key_ty key, el_ty el )
 
-    #define CC_CMPR ty, { function body }
-    #include "cc.h"
+      Inserts element el with the specified key.
+      If an element with the same key already exists, the existing element is replaced.
+      Returns a pointer-iterator to the new element, or NULL in the case of memory allocation failure.
 
-      Defines a comparison function for type ty.
-      The signature of the function is int ( ty val_1, ty val_2 ).
-      The function should return 0 if val_1 and val_2 are equal, a negative integer if val_1 is less than val_2, and a
-      positive integer if val_1 is more than val_2.
+    el_ty *insert_uninit( omap( key_ty, el_ty ) *cntr, key_ty key )
 
-    #define CC_HASH ty, { function body }
-    #include "cc.h"
+      Inserts an uninitialized element with the specified key.
+      If an element with the same key already exists, the existing element is destroyed (via the element type's
+      destructor, if it exists) and left uninitialized in its place.
+      Returns a pointer-iterator to the element, which the caller must construct in place, or NULL in the case of memory
+      allocation failure.
 
-      Defines a hash function for type ty.
-      The signature of the function is size_t ( ty val ).
-      The function should return the hash of val.
+    el_ty *get( omap( key_ty, el_ty ) *cntr, key_ty key )
 
-    #define CC_LOAD ty, max_load_factor
+      Returns a pointer-iterator to the element with the specified key, or NULL if no such element exists.
 
-      Defines the max load factor for type ty.
-      max_load_factor should be a float or double between 0.0 and 1.0.
-      The default max load factor is 0.8.
-    
-    Trivial example:
+    bool insert_keys( omap( key_ty, el_ty ) *cntr, key_ty *keys, el_ty *els, size_t n )
 
-      typedef struct { int x; } our_type;
-      #define CC_DTOR our_type, { printf( "!%d\n", val.x ); }
-      #define CC_CMPR our_type, { return ( val_1.x > val_2.x ) - ( val_1.x < val_2.x ); }
-      #define CC_HASH our_type, { return val.x * 2654435761ull; }
-      #define CC_LOAD our_type, 0.5
-      #include "cc.h"
+      Inserts the n elements in array els with the corresponding keys in array keys, replacing any existing elements
+      with the same keys.
+      If the ordered map is empty and keys is sorted in strictly ascending order, the tree is built directly from the
+      arrays in a single pass, so this is the fastest way to bulk load an ordered map from sorted input.
+      Returns true, or false if unsuccessful due to memory allocation failure (in which case no elements are inserted).
 
-    Notes:
-    - These functions are inline and have static scope, so you need to either redefine them in each translation unit
-      from which they should be called or (preferably) define them in a shared header. For structs or unions, a sensible
-      place to define them would be immediately after the definition of the struct or union.
-    - Only one destructor, comparison, or hash function or max load factor should be defined by the user for each type.
-    - #including cc.h in these cases does not #include the full header, so you still need to #include it separately
-      at the top of your files.
-    - In-built comparison and hash functions are already defined for the following types: char, unsigned char, signed
-      char, unsigned short, short, unsigned int, int, unsigned long, long, unsigned long long, long long, size_t, and
-      char * (a NULL-terminated string). Defining a comparsion or hash function for one of these types will overwrite
-      the in-built function.
+    el_ty *get_or_insert( omap( key_ty, el_ty ) *cntr, key_ty key, el_ty el )
 
-Version history:
+      Inserts element el if no element with the specified key already exist.
+      Returns a pointer-iterator to the new element if it was inserted, or a pointer-iterator to the existing
+      element with the same key, or NULL in the case of memory allocation failure.
+      Determine whether an element was inserted by comparing the ordered map's size before and after the call.
 
-  XXXXXXXXXX 1.0.3: Completed refractor that reduces compile speed by approximate XX% in C with GCC (though C++ compile
-                    speed has increased).
-                    This was achieved by reducing the number of _Generic expressions that API calls use (by extracting
-                    multiple key-related data from a single expression) and by reducing the work done inside _Generic
-                    expressions.
-                    Also introduced performance improvements into maps and sets and corrected a bug that could cause
-                    map and set probe length offset integers to be unaligned.
-  04/02/2023 1.0.2: Fixed bug preventing custom hash table load factors from taking effect when CC_LOAD is defined in
-                    isolation of CC_HASH, CC_CMPR, or CC_DTOR.
-                    Made minor adjustment to code comments and documentation so that they are more consistent.
-  27/01/2023 1.0.1: Made minor corrections to code comments.
-  26/12/2022 1.0.0: Initial release.
+    el_ty *get_or_insert_uninit( omap( key_ty, el_ty ) *cntr, key_ty key, bool *inserted )
 
-License (MIT):
+      Inserts an uninitialized element if no element with the specified key already exists.
+      Sets *inserted to true if the element was inserted, in which case the caller must construct it in place, or false
+      otherwise.
+      Returns a pointer-iterator to the new or existing element, or NULL in the case of memory allocation failure.
 
-  Copyright (c) 2022-2023 Jackson L. Allan
+    el_ty *lower_bound( omap( key_ty, el_ty ) *cntr, key_ty key )
 
-  Permission is hereby granted, free of charge, to any person obtaining a copy
-  of this software and associated documentation files (the "Software"), to deal
-  in the Software without restriction, including without limitation the rights
-  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-  copies of the Software, and to permit persons to whom the Software is
-  furnished to do so, subject to the following conditions:
+      Returns a pointer-iterator to the first element whose key is not less than key, or an end pointer-iterator if no
+      such element exists.
 
-  The above copyright notice and this permission notice shall be included in all
-  copies or substantial portions of the Software.
+    el_ty *upper_bound( omap( key_ty, el_ty ) *cntr, key_ty key )
 
-  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-  SOFTWARE.
-*/
+      Returns a pointer-iterator to the first element whose key is greater than key, or an end pointer-iterator if no
+      such element exists.
+      A range scan over the keys in [ lo, hi ) is therefore
+        for( el_ty *i = lower_bound( cntr, lo ); i != end( cntr ) && *key_for( cntr, i ) < hi; i = next( cntr, i ) )
 
-#if !defined( CC_DTOR ) && !defined( CC_CMPR ) && !defined( CC_HASH ) && !defined( CC_LOAD )/*------------------------*/
-/*                                                                                                                    */
-/*                                                REGULAR HEADER MODE                                                 */
-/*                                                                                                                    */
-/*--------------------------------------------------------------------------------------------------------------------*/
+    const key_ty *key_for( omap( key_ty, el_ty ) *cntr, el_ty *i )
 
-#ifndef CC_NO_SHORT_NAMES
-#define vec( ... )           cc_vec( __VA_ARGS__ )
-#define list( ... )          cc_list( __VA_ARGS__ )
-#define map( ... )           cc_map( __VA_ARGS__ )
-#define set( ... )           cc_set( __VA_ARGS__ )
-#define init( ... )          cc_init( __VA_ARGS__ )
-#define init_clone( ... )    cc_init_clone( __VA_ARGS__ )
-#define size( ... )          cc_size( __VA_ARGS__ )
-#define cap( ... )           cc_cap( __VA_ARGS__ )
-#define reserve( ... )       cc_reserve( __VA_ARGS__ )
-#define resize( ... )        cc_resize( __VA_ARGS__ )
-#define shrink( ... )        cc_shrink( __VA_ARGS__ )
-#define insert( ... )        cc_insert( __VA_ARGS__ )
-#define insert_n( ... )      cc_insert_n( __VA_ARGS__ )
-#define get_or_insert( ... ) cc_get_or_insert( __VA_ARGS__ )
-#define push( ... )          cc_push( __VA_ARGS__ )
-#define push_n( ... )        cc_push_n( __VA_ARGS__ )
-#define splice( ... )        cc_splice( __VA_ARGS__ )
-#define get( ... )           cc_get( __VA_ARGS__ )
-#define key_for( ... )       cc_key_for( __VA_ARGS__ )
-#define erase( ... )         cc_erase( __VA_ARGS__ )
-#define erase_n( ... )       cc_erase_n( __VA_ARGS__ )
-#define erase_itr( ... )     cc_erase_itr( __VA_ARGS__ )
-#define clear( ... )         cc_clear( __VA_ARGS__ ) 
-#define cleanup( ... )       cc_cleanup( __VA_ARGS__ )
-#define first( ... )         cc_first( __VA_ARGS__ )
-#define last( ... )          cc_last( __VA_ARGS__ )
-#define r_end( ... )         cc_r_end( __VA_ARGS__ )
-#define end( ... )           cc_end( __VA_ARGS__ )
-#define next( ... )          cc_next( __VA_ARGS__ )
-#define prev( ... )          cc_prev( __VA_ARGS__ )
-#define for_each( ... )      cc_for_each( __VA_ARGS__ )
-#define r_for_each( ... )    cc_r_for_each( __VA_ARGS__ )
-#endif
+      Returns a const pointer to the key for the element pointed to by pointer-iterator i.
 
-#ifndef CC_H
-#define CC_H
+    bool erase( omap( key_ty, el_ty ) *cntr, key_ty key )
 
-#include <stdalign.h>
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdlib.h>
-#include <string.h>
+      Erases the element with the specified key, if it exists.
+      Returns true if an element was erased, or false if no such element exists.
 
-#ifdef __cplusplus
-#include <type_traits>
-#endif
+    void erase_itr( omap( key_ty, el_ty ) *cntr, el_ty *i )
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/*                                                    Preliminary                                                     */
-/*--------------------------------------------------------------------------------------------------------------------*/
+      Erases the element pointed to by pointer-iterator i.
 
-// _Static_assert alternative that can be used inside an expression.
-#define CC_STATIC_ASSERT( xp ) (void)sizeof( char[ (xp) ? 1 : -1 ] )
+    el_ty *first( omap( key_ty, el_ty ) *cntr )
 
-// CC_MAKE_LVAL_COPY macro for making an addressable temporary copy of a variable or expression.
-// The copy is valid until at least the end of full expression surrounding the macro call.
-// In C, this is accomplished using a compound literal.
-// In C++, we use rvalue reference magic.
-// This is used to pass a pointers to elements and keys (which the user may have provided as rvalues) into container
-// functions.
-#ifdef __cplusplus
-template<class ty> ty& cc_unmove( ty&& var ) { return var; }
-#define CC_MAKE_LVAL_COPY( ty, xp ) cc_unmove( (ty)( xp ) )
-#else
-#define CC_MAKE_LVAL_COPY( ty, xp ) *( ty[ 1 ] ){ xp }
-#endif
+      Returns a pointer-iterator to the element with the lowest key, or an end pointer-iterator if the ordered map is
+      empty.
 
-// Macro used primarily for silencing unused-expression warnings for macros that return cast pointers.
-// This issued seems to affect Clang in particular.
-// GCC, on the other hand, seems to accept that pointer casts may be redundant.
-#ifdef __cplusplus
-template<typename ty_1, typename ty_2> ty_1 cc_maybe_unused( ty_2 xp ){ return (ty_1)xp; }
-#define CC_CAST_MAYBE_UNUSED( ty, xp ) cc_maybe_unused<ty>( xp )
-#else
-#define CC_CAST_MAYBE_UNUSED( ty, xp ) ( ( ty ){ 0 } = ( (ty)( xp ) ) )
-#endif
+    el_ty *last( omap( key_ty, el_ty ) *cntr )
 
-// CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2 is the same as above, except that it selects the type to which to cast based on
-// a condition.
-// This is neccessary because some API macros (e.g. cc_erase) return either a pointer-iterator or a bool depending on
-// the container type.
+      Returns a pointer-iterator to the element with the highest key, or an r_end pointer-iterator if the ordered map
+      is empty.
 
-#ifdef __cplusplus
+    el_ty *r_end( omap( key_ty, el_ty ) *cntr )
 
-template<bool cond, class ty_1, class ty_2, class xp_ty, typename std::enable_if<cond, bool>::type = true> \
-ty_1 cc_if_then_cast_ty_1_else_cast_ty_2( xp_ty xp ){ return (ty_1)xp; }                                   \
+      Returns an r_end (reverse end) pointer-iterator for the ordered map.
 
-template<bool cond, class ty_1, class ty_2, class xp_ty, typename std::enable_if<!cond, bool>::type = true> \
-ty_2 cc_if_then_cast_ty_1_else_cast_ty_2( xp_ty xp ){ return (ty_2)xp; }                                    \
+    el_ty *end( omap( key_ty, el_ty ) *cntr )
 
-#define CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2( cond, ty_1, ty_2, xp ) \
-cc_if_then_cast_ty_1_else_cast_ty_2<cond, ty_1, ty_2>( xp )         \
+      Returns an end pointer-iterator for the ordered map.
 
-#else
+    el_ty *next( omap( key_ty, el_ty ) *cntr, el_ty *i )
 
-#define CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2( cond, ty_1, ty_2, xp ) \
-CC_CAST_MAYBE_UNUSED(                                               \
-  CC_TYPEOF_XP(                                                     \
-    _Generic( (char (*)[ 1 + (bool)( cond ) ]){ 0 },                \
-        char (*)[ 1 ]: (ty_2){ 0 },                                 \
-        char (*)[ 2 ]: (ty_1){ 0 }                                  \
-    )                                                               \
-  ),                                                                \
-  ( xp )                                                            \
-)                                                                   \
+      Returns a pointer-iterator to the element with the next higher key after the one pointed to by i.
+      If i points to the last element, the value returned is an end pointer-iterator.
+      If i points to r_end, the value returned points to the first element, or is an end pointer-iterator if the
+      ordered map is empty.
 
-#endif
+    el_ty *prev( omap( key_ty, el_ty ) *cntr, el_ty *i )
 
-// In GCC and Clang, we can generate a warning if the user passes an expression that may have side effects as the first
-// argument of API macros.
-// If the expression could have side effects, the compiler will not able able to resolve a comparision of it with itself
-// at compile time, which we can check using __builtin_constant_p.
-// The warning itself is generated via a division by zero.
-// This macro may produce false positives (e.g. for &our_containers[ our_func() ] where our_func is a pure function that
-// always returns the same value), but that is a reasonable price to pay for more macro safety.
+      Returns a pointer-iterator to the element with the next lower key before the one pointed to by i.
+      If i points to the first element, the value returned is an r_end pointer-iterator.
+      If i points to end, then the value returned points to the last element, or is an r_end pointer-iterator if the
+      ordered map is empty.
 
-#ifdef __GNUC__
+    for_each( omap( key_ty, el_ty ) *cntr, key_ptr_name, i_name )
 
-#define CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr )                                                            \
-(void)(                                                                                                   \
-  "WARNING: CONTAINER ARGUMENT MAY HAVE DUPLICATED SIDE EFFECTS" &&1/__builtin_constant_p((cntr)==(cntr)) \
-)                                                                                                         \
+      Creates a loop iterating over all elements in ascending key order, with easy access to the corresponding keys.
+      This macro declares a pointer to the key (const key_ty *) named key_ptr_name and a pointer-iterator (el_ty *)
+      named i_name.
+      It should be followed by the body of the loop.
 
-#else
-#define CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ) (void)0
-#endif
+    r_for_each( omap( key_ty, el_ty ) *cntr, i_name )
 
-// Typeof for expressions and abstract declarations.
-#ifdef __cplusplus
-#define CC_TYPEOF_XP( xp ) std::decay<std::remove_reference<decltype( xp )>::type>::type
-#define CC_TYPEOF_TY( ty ) std::decay<std::remove_reference<decltype( std::declval<ty>() )>::type>::type
-#else
-// TODO: Add C23 check once C23 is supported by major compilers.
-#define CC_TYPEOF_XP( xp ) __typeof__( xp )
-#define CC_TYPEOF_TY( ty ) __typeof__( ty )
-#endif
+      Creates a loop iterating over all elements in descending key order.
+      This macro declares an el_ty * pointer-iterator named i_name.
+      It is equivalent to
+        for( el_ty *i_name = last( cntr ); i_name != r_end( cntr ); i_name = prev( cntr, i_name ) )
+      and should be followed by the body of the loop.
 
-// CC_SELECT_ON_NUM_ARGS macro for overloading API macros based on number of arguments.
-#define CC_CAT_2_( a, b ) a##b
-#define CC_CAT_2( a, b ) CC_CAT_2_( a, b )
-#define CC_N_ARGS_( _1, _2, _3, _4, _5, _6, n, ... ) n
-#define CC_N_ARGS( ... ) CC_N_ARGS_( __VA_ARGS__, _6, _5, _4, _3, _2, _1, x )
-#define CC_SELECT_ON_NUM_ARGS( func, ... ) CC_CAT_2( func, CC_N_ARGS( __VA_ARGS__ ) )( __VA_ARGS__ )
+    r_for_each( omap( key_ty, el_ty ) *cntr, key_ptr_name, i_name )
 
-// If the user has defined CC_REALLOC and CC_FREE, then CC_GET_REALLOC and CC_GET_FREE are replaced with those macros.
-// Otherwise, they are replaced by realloc and free from the standard library.
-#define CC_ARG_2_( _1, _2, ... ) _2
-#define CC_ARG_2( ... ) CC_ARG_2_( __VA_ARGS__ )
-#define CC_REALLOC_COMMA ,
-#define CC_REALLOC_FN CC_ARG_2( CC_CAT_2( CC_REALLOC, _COMMA ) realloc, CC_REALLOC, )
-#define CC_FREE_COMMA ,
-#define CC_FREE_FN CC_ARG_2( CC_CAT_2( CC_FREE, _COMMA ) free, CC_FREE, )
+      Creates a loop iterating over all elements in descending key order, with easy access to the corresponding keys.
+      This macro declares a pointer to the key (const key_ty *) named key_ptr_name and a pointer-iterator (el_ty *)
+      named i_name.
+      It should be followed by the body of the loop.
 
-// Macro used with CC_STATIC_ASSERT to provide type safety in cc_init_clone and cc_splice calls.
-#ifdef __cplusplus
-#define CC_IS_SAME_TY( a, b ) std::is_same<CC_TYPEOF_XP( a ), CC_TYPEOF_XP( b )>::value
-#else
-#define CC_IS_SAME_TY( a, b ) _Generic( (a), CC_TYPEOF_XP( b ): true, default: false )
-#endif
+    Notes:
+    - Elements move between nodes as the tree is rebalanced, so ordered map pointer-iterators may be invalidated by
+      any insertion or erasure, not only by API calls that cause memory reallocation.
+      r_end and end may be invalidated by any API calls that cause memory reallocation.
 
-// Macro for handling unused paramaters in most container functions that plug directly into API macros.
-// These functions must provide a standardized signature across containers.
-// The compiler should optimize away unused paramaters anyway, but we can nevertheless mark them as redundant.
-#ifdef __cplusplus
-#define CC_UNUSED( ty, name ) ty
-#else
-#ifdef __GNUC__
-#define CC_UNUSED( ty, name ) __attribute__((unused)) ty name
-#else
-#define CC_UNUSED( ty, name ) ty name
-#endif
-#endif
+  Ordered set (a B-tree for elements without a separate key, kept in ascending order):
 
-// Some functions that must return true/false must return the value in the form of a pointer.
-// This is because they are paired in ternary expressions inside API macros with other functions for other containers
-// that return a pointer (primarily cc_erase).
-// While any suitably aligned pointer - e.g. the container handle - would do, we declare a global cc_dummy_true_ptr for
-// the sake of code readability.
-static max_align_t cc_dummy_true;
-static void *cc_dummy_true_ptr = &cc_dummy_true;
+    oset( el_ty ) cntr
 
-// Default max load factor for maps and sets.
-#define CC_DEFAULT_LOAD 0.75
+      Declares an uninitialized ordered set named cntr.
+      el_ty must be a type, or alias for a type, for which a comparison function has been defined.
+      This requirement is enforced internally such that neglecting it causes a compiler error.
+      For types with in-built comparison functions, and for details on how to declare new comparison functions, see
+      "Destructor, comparison, and hash functions and custom max load factors" below.
 
-// Types for comparison, hash, destructor, realloc, and free functions.
-// These are only for internal use as user-provided comparison, hash, and destructor have a different signature (see
-// documentation above).
-typedef int ( *cc_cmpr_fnptr_ty )( void *, void * );
-typedef size_t ( *cc_hash_fnptr_ty )( void * );
-typedef void ( *cc_dtor_fnptr_ty )( void * );
-typedef void *( *cc_realloc_fnptr_ty )( void *, size_t );
-typedef void ( *cc_free_fnptr_ty )( void * );
+    el_ty *insert( oset( el_ty ) *cntr, el_ty el )
 
-// Swaps a block of memory (used for Robin-Hooding in maps and sets).
-// Implemented as a macro to ensure inlining.
-#define CC_MEMSWAP( a, b, size )                  \
-{                                                 \
-  char *aa = (char *)(a);                         \
-  char *bb = (char *)(b);                         \
-  size_t bytes_left = (size);                     \
-                                                  \
-  alignas( max_align_t ) char copy_buffer[ 256 ]; \
-                                                  \
-  while( bytes_left > 256 )                       \
-  {                                               \
-    memcpy( copy_buffer, aa, 256 );               \
-    memcpy( aa, bb, 256 );                        \
-    memcpy( bb, copy_buffer, 256 );               \
-    aa += 256;                                    \
-    bb += 256;                                    \
-    bytes_left -= 256;                            \
-  }                                               \
-                                                  \
-  memcpy( copy_buffer, aa, bytes_left );          \
-  memcpy( aa, bb, bytes_left );                   \
-  memcpy( bb, copy_buffer, bytes_left );          \
-}                                                 \
-/*
-static inline __attribute__((always_inline)) void cc_memswap( void *a, void *b, size_t size )
-{
-  alignas( max_align_t ) char copy_buffer[ 256 ];
+      Inserts element el.
+      If the element already exists, the existing element is replaced.
+      Returns a pointer-iterator to the new element, or NULL in the case of memory allocation failure.
 
-  char *aa = (char *)a;
-  char *bb = (char *)b;
-  while( size > 256 )
-  {
-    memcpy( copy_buffer, aa, 256 );
-    memcpy( aa, bb, 256 );
-    memcpy( bb, copy_buffer, 256 );
-    aa += 256;
-    bb += 256;
-    size -= 256;
-  }
+    el_ty *get( oset( el_ty ) *cntr, el_ty el )
 
-  memcpy( copy_buffer, aa, size );
-  memcpy( aa, bb, size );
-  memcpy( bb, copy_buffer, size );
-}
+      Returns a pointer-iterator to element el, or NULL if no such element exists.
 
-static inline __attribute__((always_inline)) void cc_memswap2( void *a, void *b, size_t size_ab, void *c, void *d, size_t size_cd )
-{
-  alignas( max_align_t ) char copy_buffer[ 256 ];
+    bool insert_keys( oset( el_ty ) *cntr, el_ty *els, size_t n )
 
-  char *aa = (char *)a;
-  char *bb = (char *)b;
-  while( size_ab > 256 )
-  {
-    memcpy( copy_buffer, aa, 256 );
-    memcpy( aa, bb, 256 );
-    memcpy( bb, copy_buffer, 256 );
-    aa += 256;
-    bb += 256;
-    size_ab -= 256;
-  }
+      Inserts the n elements in array els, replacing any existing elements.
+      If the ordered set is empty and els is sorted in strictly ascending order, the tree is built directly from the
+      array in a single pass, so this is the fastest way to bulk load an ordered set from sorted input.
+      Returns true, or false if unsuccessful due to memory allocation failure (in which case no elements are inserted).
 
-  memcpy( copy_buffer, aa, size_ab );
-  memcpy( aa, bb, size_ab );
-  memcpy( bb, copy_buffer, size_ab );
+    el_ty *get_or_insert( oset( el_ty ) *cntr, el_ty el )
 
-  char *cc = (char *)c;
-  char *dd = (char *)d;
-  while( size_cd > 256 )
-  {
-    memcpy( copy_buffer, cc, 256 );
-    memcpy( cc, dd, 256 );
-    memcpy( dd, copy_buffer, 256 );
-    cc += 256;
-    bb += 256;
-    size_cd -= 256;
-  }
+      Inserts element el if it does not already exist.
+      Returns a pointer-iterator to the new element if it was inserted, or a pointer-iterator to the existing element,
+      or NULL in the case of memory allocation failure.
+      Determine whether an element was inserted by comparing the ordered set's size before and after the call.
 
-  memcpy( copy_buffer, cc, size_cd );
-  memcpy( cc, dd, size_cd );
-  memcpy( dd, copy_buffer, size_cd );
-}*/
+    el_ty *lower_bound( oset( el_ty ) *cntr, el_ty el )
 
-// Container ids to identify container type at compile-time.
-#define CC_VEC  1
-#define CC_LIST 2
-#define CC_MAP  3
-#define CC_SET  4
+      Returns a pointer-iterator to the first element not less than el, or an end pointer-iterator if no such element
+      exists.
 
-// Produces underlying function pointer type for a given element/key type pair.
-#define CC_MAKE_BASE_FNPTR_TY( el_ty, key_ty ) CC_TYPEOF_TY( CC_TYPEOF_TY( el_ty ) (*)( CC_TYPEOF_TY( key_ty )* ) )
+    el_ty *upper_bound( oset( el_ty ) *cntr, el_ty el )
 
-// Produces container handle for a given element type, key type, and container id.
-// In other words, this macro creates a pointer that carries all the information needed to identify and operate on a
-// container at compile time: el_ty (*(*)[ cntr_id ])( key_ty * ).
-// That is a pointer to an array of function pointers whose signature is el_ty ( key_ty * ).
-#define CC_MAKE_CNTR_TY( el_ty, key_ty, cntr_id ) CC_TYPEOF_TY( CC_MAKE_BASE_FNPTR_TY( el_ty, key_ty )(*)[ cntr_id ] )
+      Returns a pointer-iterator to the first element greater than el, or an end pointer-iterator if no such element
+      exists.
 
-// API macros for declaring containers.
-// The key type is the type uses to lookup elements, even in nonassociative containers (e.g. a vector's key type is a
-// size_t array index).
-// This simplifies API macros by eliminating the need to treat non-associative containers as special cases.
+    bool erase( oset( el_ty ) *cntr, el_ty el )
 
-#define cc_vec( el_ty )         CC_MAKE_CNTR_TY( el_ty, size_t, CC_VEC )
+      Erases the element el, if it exists.
+      Returns true if an element was erased, or false if no such element exists.
 
-#define cc_list( el_ty )        CC_MAKE_CNTR_TY( el_ty, void *, CC_LIST ) // List key is a pointer-iterator.
+    void erase_itr( oset( el_ty ) *cntr, el_ty *i )
 
-#define cc_map( key_ty, el_ty ) CC_MAKE_CNTR_TY(                                                       \
-                                  el_ty,                                                               \
-                                  key_ty,                                                              \
-                                  CC_MAP * ( (                                                         \
-                                    /* Compiler error if key type lacks compare and hash functions. */ \
-                                    CC_HAS_CMPR( key_ty ) && CC_HAS_HASH( key_ty ) &&                  \
-                                    /* Compiler error if bucket layout constraints are violated. */    \
-                                    CC_SATISFIES_LAYOUT_CONSTRAINTS( key_ty, el_ty )                   \
-                                  ) ? 1 : -1 )                                                         \
-                                )                                                                      \
+      Erases the element pointed to by pointer-iterator i.
 
-#define cc_set( el_ty )         CC_MAKE_CNTR_TY(                                                                   \
-                                  /* As set simply wraps map, we use el_ty as both the element and key types. */   \
-                                  /* This allows minimal changes to map macros and functions to make sets work. */ \
-                                  el_ty,                                                                           \
-                                  el_ty,                                                                           \
-                                  CC_SET * ( (                                                                     \
-                                    /* Compiler error if key type lacks compare and hash functions. */             \
-                                    CC_HAS_CMPR( el_ty ) && CC_HAS_HASH( el_ty ) &&                                \
-                                    /* Compiler error if bucket layout constraints are violated. */                \
-                                    CC_SATISFIES_LAYOUT_CONSTRAINTS( el_ty, el_ty )                                \
-                                  ) ? 1 : -1 )                                                                     \
-                                )                                                                                  \
+    el_ty *first( oset( el_ty ) *cntr )
 
-// Retrieves a container's id (CC_VEC, CC_LIST, etc.) from its handle.
-#define CC_CNTR_ID( cntr ) ( sizeof( *cntr ) / sizeof( **cntr ) )
+      Returns a pointer-iterator to the lowest element, or an end pointer-iterator if the ordered set is empty.
 
-// Retrieves a container's element type from its handle.
-#define CC_EL_TY( cntr ) CC_TYPEOF_XP( (**cntr)( NULL ) )
+    el_ty *last( oset( el_ty ) *cntr )
 
-// Easy access to a container's element and key sizes.
-#define CC_EL_SIZE( cntr )  sizeof( CC_EL_TY( cntr ) )
+      Returns a pointer-iterator to the highest element, or an r_end pointer-iterator if the ordered set is empty.
 
-// CC_KEY_TY macros for retrieving a container's key type from its handle (i.e. from the argument of the base function
-// pointer).
-#ifdef __cplusplus // For C++, this can be done easily with the help of a template function.
+    el_ty *r_end( oset( el_ty ) *cntr )
 
-template<typename el_ty, typename key_ty>
-key_ty cc_key_ty( el_ty (*)( key_ty * ) )
-{
-  key_ty dummy;
-  return dummy;
-}
+      Returns an r_end (reverse end) pointer-iterator for the ordered set.
 
-#define CC_KEY_TY( cntr ) CC_TYPEOF_XP( cc_key_ty( **cntr ) )
+    el_ty *end( oset( el_ty ) *cntr )
 
-#else // For C, we need to use _Generic trickery to match the base function pointer type with a key type previously
-      // coupled with a compare function.
+      Returns an end pointer-iterator for the ordered set.
 
-#define CC_KEY_TY_SLOT( n, arg ) CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( arg ), cc_cmpr_##n##_ty ): ( cc_cmpr_##n##_ty ){ 0 },
-#define CC_KEY_TY( cntr )                                                                         \
-CC_TYPEOF_XP(                                                                                     \
-  _Generic( (**cntr),                                                                             \
-    CC_FOR_EACH_CMPR( CC_KEY_TY_SLOT, cntr )                                                      \
-    default: _Generic( (**cntr),                                                                  \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), char ):               ( char ){ 0 },               \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned char ):      ( unsigned char ){ 0 },      \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), signed char ):        ( signed char ){ 0 },        \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned short ):     ( unsigned short ){ 0 },     \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), short ):              ( short ){ 0 },              \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned int ):       ( unsigned int ){ 0 },       \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), int ):                ( int ){ 0 },                \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned long ):      ( unsigned long ){ 0 },      \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), long ):               ( long ){ 0 },               \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned long long ): ( unsigned long long ){ 0 }, \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), long long ):          ( long long ){ 0 },          \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), cc_maybe_size_t ):    ( size_t ){ 0 },             \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), char * ):             ( char * ){ 0 },             \
-      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), void * ):             ( void * ){ 0 },             \
-      default: (char){ 0 } /* Nothing */                                                          \
-    )                                                                                             \
-  )                                                                                               \
-)                                                                                                 \
+    el_ty *next( oset( el_ty ) *cntr, el_ty *i )
 
-#endif
+      Returns a pointer-iterator to the next higher element after the one pointed to by i.
+      If i points to the last element, the pointer-iterator returned is an end pointer-iterator.
+      If i points to r_end, then the pointer-iterator returned points to the first element, or is an end
+      pointer-iterator if the ordered set is empty.
 
-// Probe length type for maps and sets (Robin Hood hash tables).
-// An unsigned char would probably be fine, but we use unsigned int just in case.
-// A probe length of 0 denotes an empty bucket, whereas a probe length of 1 denotes an element in its home bucket.
-// This optimization allows us to eliminate separate checks for empty buckets.
-typedef unsigned int cc_probelen_ty;
+    el_ty *prev( oset( el_ty ) *cntr, el_ty *i )
 
-// The functions associated with some containers require extra information about how elements and/or keys and other data
-// are laid out in memory.
-// In particular, maps and sets need information about their bucket layouts, which depend on their element and/or key
-// types (a future implementation of ordered maps and sets will also require such data).
-// This data is formed by extracting the key size and alignment and passing it, along with the element size and
-// alignment and the container type id, into the cc_layout function, which returns a uint64_t describing the layout.
-// The key size and alignment are inferred via a _Generic macro that looks up the key type based on the default
-// or user-supplied comparison functions, since all containers that require layout information also require a comparison
-// function.
-// Although this mechanism is convoluted, it has proven to compile much faster than other approaches (e.g. calculating
-// the layout inside a _Generic macro).
-// The compiler should optimize the entire mechanism into compile-time constants.
+      Returns a pointer-iterator to the next lower element before the one pointed to by i.
+      If i points to the first element, the return value is an r_end pointer-iterator.
+      If i points to end, then the pointer-iterator returned points to the last element, or is an r_end pointer-iterator
+      if the ordered set is empty.
 
-// The layout for a map bucket is:
-//   +------------+----+------------+----+------------+----+
-//   |     #1     | #2 |     #3     | #4 |     #5     | #6 |
-//   +------------+----+------------+----+------------+----+
-//   #1 Element.
-//   #2 Element padding to key_ty alignment.
-//   #3 Key.
-//   #4 Key padding to cc_probelen_ty alignment.
-//   #5 Probe length.
-//   #6 #5 Probe length padding to largerst of el_ty, key_ty, and cc_probelen_ty alignments.
+    r_for_each( oset( el_ty ) *cntr, i_name )
 
-// The layout for a set bucket is:
-//   +------------+----+------------+----+
-//   |     #1     | #2 |     #3     | #4 |
-//   +------------+----+------------+----+
-//   #1 Element (el_ty and key_ty are the same).
-//   #2 Padding to cc_probelen_ty alignment.
-//   #3 Probe length.
-//   #4 Padding to el_ty alignment.
+      Creates a loop iterating over all elements in descending order.
+      This macro declares an el_ty * pointer-iterator named i_name.
+      It is equivalent to
+        for( el_ty *i_name = last( cntr ); i_name != r_end( cntr ); i_name = prev( cntr, i_name ) )
+      and should be followed by the body of the loop.
 
-// The layout data passed into a container function is a uint64_t composed of a uint32_t denoting the key size, a
-// uint8_t denoting the padding after the element, a uint8_t denoting the padding after the key, and a uint8_t
-// denoting the padding after the probe length.
-// The reason that a uint64_t, rather than a struct, is used is that GCC has trouble properly optimizing the passing
-// of the struct - even if only 8 bytes - into some container functions (specifically cc_map_insert), apparently because
-// it declines to pass the struct by register.
+    Notes:
+    - Ordered set pointer-iterators may be invalidated by any insertion or erasure.
+      r_end and end may be invalidated by any API calls that cause memory reallocation.
 
-// Macro for ensuring valid layout on container declaration.
+  Dense map (an unordered container associating elements with keys, stored contiguously in insertion order and indexed
+  by a Robin Hood hash table):
+
+    dmap( key_ty, el_ty ) cntr
+
+      Declares an uninitialized dense map named cntr.
+      key_ty must be a type, or alias for a type, for which comparison and hash functions have been defined.
+      This requirement is enforced internally such that neglecting it causes a compiler error.
+      For types with in-built comparison and hash functions, and for details on how to declare new comparison and hash
+      functions, see "Destructor, comparison, and hash functions and custom max load factors" below.
+      Elements and their keys are packed into a single array, and the hash table's eight-byte buckets hold only indices
+      into that array, so iteration is a linear sweep whose cost depends on the size rather than the capacity.
+      A dense map can hold at most UINT32_MAX elements.
+
+    size_t cap( dmap( key_ty, el_ty ) *cntr )
+
+      Returns the current capacity, i.e. the number of elements the dense map can hold without reallocating.
+
+    bool reserve( dmap( key_ty, el_ty ) *cntr, size_t n )
+
+      Ensures that the capacity is large enough to support n elements without reallocating.
+      Returns true, or false if unsuccessful due to memory allocation failure.
+
+    bool shrink( dmap( key_ty, el_ty ) *cntr )
+
+      Shrinks the capacity to best accommodate the current size.
+      Returns true, or false if unsuccessful due to memory allocation failure.
+
+    el_ty *insert( dmap( key_ty, el_ty ) *cntr, key_ty key, el_ty el )
+
+      Inserts element el with the specified key.
+      If an element with the same key already exists, the existing element is replaced in its current position.
+      Otherwise, the element is appended after the last element.
+      Returns a pointer-iterator to the new element, or NULL in the case of memory allocation failure.
+
+    el_ty *insert_uninit( dmap( key_ty, el_ty ) *cntr, key_ty key )
+
+      Inserts an uninitialized element with the specified key.
+      If an element with the same key already exists, the existing element is destroyed (via the element type's
+      destructor, if it exists) and left uninitialized in its current position.
+      Otherwise, the element is appended after the last element.
+      Returns a pointer-iterator to the element, which the caller must construct in place, or NULL in the case of memory
+      allocation failure.
+
+    el_ty *get( dmap( key_ty, el_ty ) *cntr, key_ty key )
+
+      Returns a pointer-iterator to the element with the specified key, or NULL if no such element exists.
+
+    el_ty *get_or_insert( dmap( key_ty, el_ty ) *cntr, key_ty key, el_ty el )
+
+      Inserts element el if no element with the specified key already exist.
+      Returns a pointer-iterator to the new element if it was inserted, or a pointer-iterator to the existing
+      element with the same key, or NULL in the case of memory allocation failure.
+      Determine whether an element was inserted by comparing the dense map's size before and after the call.
+
+    el_ty *get_or_insert_uninit( dmap( key_ty, el_ty ) *cntr, key_ty key, bool *inserted )
+
+      Inserts an uninitialized element if no element with the specified key already exists.
+      Sets *inserted to true if the element was inserted, in which case the caller must construct it in place, or false
+      otherwise.
+      Returns a pointer-iterator to the new or existing element, or NULL in the case of memory allocation failure.
+
+    const key_ty *key_for( dmap( key_ty, el_ty ) *cntr, el_ty *i )
+
+      Returns a const pointer to the key for the element pointed to by pointer-iterator i.
+
+    bool erase( dmap( key_ty, el_ty ) *cntr, key_ty key )
+
+      Erases the element with the specified key, if it exists.
+      The last element is moved into the erased element's position.
+      Returns true if an element was erased, or false if no such element exists.
+
+    void erase_itr( dmap( key_ty, el_ty ) *cntr, el_ty *i )
+
+      Erases the element pointed to by pointer-iterator i.
+      The last element is moved into the erased element's position, so afterwards i points to the element that was
+      last, or to end if the erased element was the last element.
+      Hence, to erase elements while iterating, advance i only when the element it points to is not erased.
+
+    el_ty *first( dmap( key_ty, el_ty ) *cntr )
+
+      Returns a pointer-iterator to the first element, or an end pointer-iterator if the dense map is empty.
+
+    el_ty *last( dmap( key_ty, el_ty ) *cntr )
+
+      Returns a pointer-iterator to the last element, or an r_end pointer-iterator if the dense map is empty.
+
+    el_ty *r_end( dmap( key_ty, el_ty ) *cntr )
+
+      Returns an r_end (reverse end) pointer-iterator for the dense map.
+
+    el_ty *end( dmap( key_ty, el_ty ) *cntr )
+
+      Returns an end pointer-iterator for the dense map.
+
+    el_ty *next( dmap( key_ty, el_ty ) *cntr, el_ty *i )
+
+      Returns a pointer-iterator to the element after the one pointed to by i.
+      If i points to the last element, the value returned is an end pointer-iterator.
+      If i points to r_end, the value returned points to the first element, or is an end pointer-iterator if the dense
+      map is empty.
+
+    el_ty *prev( dmap( key_ty, el_ty ) *cntr, el_ty *i )
+
+      Returns a pointer-iterator to the element before the one pointed to by i.
+      If i points to the first element, the value returned is an r_end pointer-iterator.
+      If i points to end, then the value returned points to the last element, or is an r_end pointer-iterator if the
+      dense map is empty.
+
+    for_each( dmap( key_ty, el_ty ) *cntr, key_ptr_name, i_name )
+
+      Creates a loop iterating over all elements from first to last, with easy access to the corresponding keys.
+      This macro declares a pointer to the key (const key_ty *) named key_ptr_name and a pointer-iterator (el_ty *)
+      named i_name.
+      It should be followed by the body of the loop.
+
+    r_for_each( dmap( key_ty, el_ty ) *cntr, i_name )
+
+      Creates a loop iterating over all elements from last to first.
+      This macro declares an el_ty * pointer-iterator named i_name.
+      It is equivalent to
+        for( el_ty *i_name = last( cntr ); i_name != r_end( cntr ); i_name = prev( cntr, i_name ) )
+      and should be followed by the body of the loop.
+
+    r_for_each( dmap( key_ty, el_ty ) *cntr, key_ptr_name, i_name )
+
+      Creates a loop iterating over all elements from last to first, with easy access to the corresponding keys.
+      This macro declares a pointer to the key (const key_ty *) named key_ptr_name and a pointer-iterator (el_ty *)
+      named i_name.
+      It should be followed by the body of the loop.
+
+    Notes:
+    - Elements are iterated in insertion order, except that erasing an element moves the last element into its place.
+    - Dense map pointer-iterators (including r_end and end) may be invalidated by any API calls that cause memory
+      reallocation, and pointer-iterators to the last element are invalidated by any erasure.
+      end is also invalidated by any insertion or erasure.
+
+  Destructor, comparison, and hash functions and custom max load factors:
+
+    This part of the API allows the user to define custom destructor, comparison, and hash functions and max load
+    factors for a type.
+    Once these functions are defined, any container using that type for its elements or keys will call them
+    automatically.
+    Once the max load factor is defined, any map using the type for its key and any set using the type for its elements
+    will use the defined load factor to determine when rehashing is necessary.
+    The same applies to the max probe length and the min load factor, the latter of which also applies to any vector
+    using the type for its elements.
+    Once the growth policy is defined, any vector using the type for its elements will use it to determine its capacity
+    when it grows.
+
+    #define CC_DTOR ty, { function body }
+    #include "cc.h"
+
+      Defines a destructor for type ty.
+      The signature of the function is void ( ty val ).
+
+    #define CC_CMPR ty, { function body }
+    #include "cc.h"
+
+      Defines a comparison function for type ty.
+      The signature of the function is int ( ty val_1, ty val_2 ).
+      The function should return 0 if val_1 and val_2 are equal, a negative integer if val_1 is less than val_2, and a
+      positive integer if val_1 is more than val_2.
+      The function also determines the order in which cc_sort and cc_stable_sort arrange the elements of vectors using
+      the type for their elements.
+
+    #define CC_HASH ty, { function body }
+    #include "cc.h"
+
+      Defines a hash function for type ty.
+      The signature of the function is size_t ( ty val ).
+      The function should return the hash of val.
+      For key types that carry their own length, such as a struct holding a pointer to string data and its size, the
+      function can return cc_hash_bytes( data, size ), a fast general-purpose hash that processes eight bytes at a
+      time.
+      This hash need not match the one CC uses for char * keys, so a key of such a type does not necessarily hash like
+      a char * to the same string.
+
+    #define CC_LOAD ty, max_load_factor
+
+      Defines the max load factor for type ty.
+      max_load_factor should be a float or double between 0.0 and 1.0.
+      The default max load factor is 0.8.
+
+    #define CC_MAX_PROBELEN ty, max_probe_length
+    #include "cc.h"
+
+      Defines the max probe length for type ty.
+      Once any element of a map or set has been placed more than max_probe_length buckets away from its home bucket
+      (counting the home bucket itself), the next insertion grows the map or set even though its max load factor is not
+      yet violated.
+      This bounds the length of lookups for key sets that cluster under the hash function, independently of the load
+      factor.
+      Growth only occurs this way while the size is at least a quarter of the capacity multiplied by the max load
+      factor, so keys that collide at any capacity (e.g. keys with identical hashes) cannot cause unbounded growth.
+      max_probe_length should be a positive integer.
+      By default, there is no max probe length.
+
+    #define CC_MIN_LOAD ty, min_load_factor
+    #include "cc.h"
+
+      Defines the min load factor for type ty.
+      Once erase, erase_with_hash, erase_keys, or erase_if leaves a map or set with fewer elements than its capacity
+      multiplied by min_load_factor, the map or set shrinks to the minimum capacity that respects its max load factor,
+      via a complete rehash or, if its key type has the CC_INCREMENTAL flag and CC_SMALL_PROBELEN is not defined, an
+      incremental one.
+      Likewise, once erase, erase_n, erase_swap, erase_swap_n, or erase_if leaves a vector whose element type is ty
+      with fewer elements than its capacity multiplied by min_load_factor, the vector's capacity shrinks to twice its
+      size.
+      To prevent alternating insertions and erasures from repeatedly growing and shrinking the container, the min load
+      factor is capped at a quarter of the max load factor (or, for vectors, at half the reciprocal of the growth factor
+      defined by CC_GROWTH), and the capacity never shrinks below the minimum capacity of a non-empty container (or, for
+      vectors, below the initial capacity defined by CC_GROWTH).
+      clear, erase_itr, and resize never shrink the container.
+      If memory allocation fails during shrinking, the container is left unchanged and the erasure still succeeds.
+      min_load_factor should be a float or double between 0.0 and 1.0.
+      By default, the min load factor is 0.0, i.e. containers only shrink when shrink is called.
+
+    #define CC_GROWTH ty, growth_factor, initial_capacity
+    #include "cc.h"
+
+      Defines the growth policy for vectors whose element type is ty.
+      When an insertion into a vector without allocated memory allocates memory, the vector's capacity starts at
+      initial_capacity.
+      Whenever an insertion exceeds the capacity, the capacity is multiplied by growth_factor (repeatedly, and by at
+      least one element each time) until it accommodates the new size.
+      A smaller growth factor (e.g. 1.5) wastes less memory and allows freed blocks to be reused by later growth, at the
+      cost of more frequent reallocation. A larger initial capacity avoids the reallocations of small vectors.
+      reserve and shrink are unaffected and still allocate exactly the requested capacity.
+      growth_factor should be a float or double greater than 1.0, and initial_capacity should be a positive integer.
+      The default growth factor is 2.0, and the default initial capacity is 2.
+
+    #define CC_FLAGS ty, flags
+    #include "cc.h"
+
+      Defines implementation flags for maps using type ty as their key type and sets using it as their element type.
+      flags should be zero or a bitwise-OR combination of the following constants:
+
+        CC_METADATA
+          Maintains a separate array of one-byte hash fragments alongside the buckets.
+          Lookups scan this array a group (16 slots with SSE2, 32 slots with AVX2, or 8 slots otherwise) at a time and
+          only compare full keys when the fragment matches, which reduces memory traffic for unsuccessful lookups and
+          for key types with large buckets or expensive comparison functions.
+          The cost is one extra byte per bucket.
+
+        CC_SOA
+          Stores the probe lengths, keys, and elements of a map in three separate arrays rather than interleaving them
+          in buckets, so that probing and iteration do not pull elements into the cache.
+          This flag benefits maps with large element types.
+          For sets, it stores the probe lengths and elements in two separate arrays, which eliminates the padding
+          between them (see CC_SMALL_PROBELEN).
+
+        CC_STORE_HASH
+          Stores the full hash of each key alongside its bucket.
+          Lookups compare the stored hash before calling the comparison function, and rehashing reuses the stored
+          hashes instead of calling the hash function again.
+          This flag benefits key types with expensive hash or comparison functions, such as strings.
+          The cost is one extra size_t per bucket.
+
+        CC_INCREMENTAL
+          Spreads the rehashing that occurs when an insertion causes the map or set to grow across subsequent
+          insertions and erasures, which each migrate a small, fixed number of buckets from the old storage to the new.
+          Until the migration is complete, both the old and new storage are kept and searched.
+          This flag removes the latency spike of rehashing the entire map or set in a single insertion.
+
+        CC_OCCUPANCY
+          Maintains a bitmap with one bit per bucket denoting whether the bucket is occupied.
+          Iteration scans this bitmap a 64-bucket word at a time instead of checking every bucket, which speeds up
+          iteration over sparsely populated maps and sets, e.g. after most elements have been erased.
+          The cost is one extra bit per bucket and a bitmap update whenever a bucket is filled or vacated.
+
+      By default, no flags are set.
+
+    Trivial example:
+
+      typedef struct { int x; } our_type;
+      #define CC_DTOR our_type, { printf( "!%d\n", val.x ); }
+      #define CC_CMPR our_type, { return ( val_1.x > val_2.x ) - ( val_1.x < val_2.x ); }
+      #define CC_HASH our_type, { return val.x * 2654435761ull; }
+      #define CC_LOAD our_type, 0.5
+      #define CC_FLAGS our_type, CC_METADATA
+      #include "cc.h"
+
+    Notes:
+    - These functions are inline and have static scope, so you need to either redefine them in each translation unit
+      from which they should be called or (preferably) define them in a shared header. For structs or unions, a sensible
+      place to define them would be immediately after the definition of the struct or union.
+    - Only one destructor, comparison, or hash function, max load factor, max probe length, min load factor, growth
+      policy, or set of flags should be defined by the user for each type.
+    - #including cc.h in these cases does not #include the full header, so you still need to #include it separately
+      at the top of your files.
+    - In-built comparison and hash functions are already defined for the following types: char, unsigned char, signed
+      char, unsigned short, short, unsigned int, int, unsigned long, long, unsigned long long, long long, size_t, and
+      char * (a NULL-terminated string). Defining a comparsion or hash function for one of these types will overwrite
+      the in-built function.
+
+Version history:
+
+  XXXXXXXXXX 1.0.3: Completed refractor that reduces compile speed by approximate XX% in C with GCC (though C++ compile
+                    speed has increased).
+                    This was achieved by reducing the number of _Generic expressions that API calls use (by extracting
+                    multiple key-related data from a single expression) and by reducing the work done inside _Generic
+                    expressions.
+                    Also introduced performance improvements into maps and sets and corrected a bug that could cause
+                    map and set probe length offset integers to be unaligned.
+                    Added CC_FLAGS and the optional CC_METADATA hash-fragment array for maps and sets.
+                    Added the optional CC_SOA structure-of-arrays layout for maps.
+                    Added the optional CC_STORE_HASH stored-hash array for maps and sets.
+                    Added the optional CC_INCREMENTAL incremental rehashing mode for maps and sets.
+                    Maps and sets now grow in place, reducing peak memory usage during rehashing.
+                    Map and set lookup, insertion, and erasure are now force-inlined (see CC_NO_ALWAYS_INLINE).
+                    Added get_n, insert_keys, and erase_keys batched operations with prefetching for maps and sets.
+                    Added hash_of and the insert, get_or_insert, get, and erase _with_hash variants for maps and sets.
+                    The default integer hash functions now mix high key bits into the low bits that select buckets.
+                    The default char * hash function now processes eight bytes at a time. Added cc_hash_bytes.
+                    Added erase_if for vectors, maps, and sets.
+                    insert_keys now places large batches in home-bucket order via a radix partition.
+                    Added CC_SMALL_PROBELEN for one-byte probe lengths. CC_SOA now also applies to sets.
+                    Map and set first and last are now constant-time, and iteration stops at the last occupied bucket.
+                    Added the optional CC_OCCUPANCY occupancy bitmap for maps and sets.
+                    Added stats for maps and sets.
+                    Added CC_MAX_PROBELEN for growing maps and sets when probe lengths exceed a per-type limit.
+                    Added CC_MIN_LOAD for automatically shrinking vectors, maps, and sets after erasures.
+                    Added CC_GROWTH for per-type vector growth policies and CC_USABLE_SIZE for counting allocator slack
+                    as vector capacity.
+                    Added CC_VEC_VM_THRESHOLD for large vectors that grow in place within virtual memory reservations.
+                    Added small vectors (svec), whose first allocation holds a declared number of elements.
+                    Added push_uninit, insert_uninit, and get_or_insert_uninit for constructing elements in place.
+                    Added erase_swap and erase_swap_n for vectors.
+                    Added cc_sort and cc_stable_sort for vectors, with radix sorting for fundamental integer types.
+                    Added B-tree ordered maps (omap) and ordered sets (oset) with lower_bound and upper_bound.
+                    Added dense maps (dmap), which store elements contiguously in insertion order.
+  04/02/2023 1.0.2: Fixed bug preventing custom hash table load factors from taking effect when CC_LOAD is defined in
+                    isolation of CC_HASH, CC_CMPR, or CC_DTOR.
+                    Made minor adjustment to code comments and documentation so that they are more consistent.
+  27/01/2023 1.0.1: Made minor corrections to code comments.
+  26/12/2022 1.0.0: Initial release.
+
+License (MIT):
+
+  Copyright (c) 2022-2023 Jackson L. Allan
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// Constants for use with CC_FLAGS.
+// These are defined outside both header modes so that they are available no matter which mode the header is first
+// #included in.
+#ifndef CC_METADATA
+#define CC_METADATA    0x01
+#endif
+#ifndef CC_SOA
+#define CC_SOA         0x02
+#endif
+#ifndef CC_STORE_HASH
+#define CC_STORE_HASH  0x04
+#endif
+#ifndef CC_INCREMENTAL
+#define CC_INCREMENTAL 0x08
+#endif
+#ifndef CC_OCCUPANCY
+#define CC_OCCUPANCY   0x10
+#endif
+
+#if !defined( CC_DTOR ) && !defined( CC_CMPR ) && !defined( CC_HASH ) && !defined( CC_LOAD ) && \
+    !defined( CC_MAX_PROBELEN ) && !defined( CC_MIN_LOAD ) && !defined( CC_GROWTH ) && !defined( CC_FLAGS )/*---------*/
+/*                                                                                                                    */
+/*                                                REGULAR HEADER MODE                                                 */
+/*                                                                                                                    */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef CC_NO_SHORT_NAMES
+#define vec( ... )                     cc_vec( __VA_ARGS__ )
+#define svec( ... )                    cc_svec( __VA_ARGS__ )
+#define list( ... )                    cc_list( __VA_ARGS__ )
+#define map( ... )                     cc_map( __VA_ARGS__ )
+#define set( ... )                     cc_set( __VA_ARGS__ )
+#define omap( ... )                    cc_omap( __VA_ARGS__ )
+#define oset( ... )                    cc_oset( __VA_ARGS__ )
+#define dmap( ... )                    cc_dmap( __VA_ARGS__ )
+#define init( ... )                    cc_init( __VA_ARGS__ )
+#define init_clone( ... )              cc_init_clone( __VA_ARGS__ )
+#define size( ... )                    cc_size( __VA_ARGS__ )
+#define cap( ... )                     cc_cap( __VA_ARGS__ )
+#define reserve( ... )                 cc_reserve( __VA_ARGS__ )
+#define resize( ... )                  cc_resize( __VA_ARGS__ )
+#define shrink( ... )                  cc_shrink( __VA_ARGS__ )
+#define stats( ... )                   cc_stats( __VA_ARGS__ )
+#define insert( ... )                  cc_insert( __VA_ARGS__ )
+#define insert_n( ... )                cc_insert_n( __VA_ARGS__ )
+#define insert_keys( ... )             cc_insert_keys( __VA_ARGS__ )
+#define insert_with_hash( ... )        cc_insert_with_hash( __VA_ARGS__ )
+#define insert_uninit( ... )           cc_insert_uninit( __VA_ARGS__ )
+#define get_or_insert( ... )           cc_get_or_insert( __VA_ARGS__ )
+#define get_or_insert_with_hash( ... ) cc_get_or_insert_with_hash( __VA_ARGS__ )
+#define get_or_insert_uninit( ... )    cc_get_or_insert_uninit( __VA_ARGS__ )
+#define push( ... )                    cc_push( __VA_ARGS__ )
+#define push_n( ... )                  cc_push_n( __VA_ARGS__ )
+#define push_uninit( ... )             cc_push_uninit( __VA_ARGS__ )
+#define splice( ... )                  cc_splice( __VA_ARGS__ )
+#define get( ... )                     cc_get( __VA_ARGS__ )
+#define get_n( ... )                   cc_get_n( __VA_ARGS__ )
+#define get_with_hash( ... )           cc_get_with_hash( __VA_ARGS__ )
+#define lower_bound( ... )             cc_lower_bound( __VA_ARGS__ )
+#define upper_bound( ... )             cc_upper_bound( __VA_ARGS__ )
+#define key_for( ... )                 cc_key_for( __VA_ARGS__ )
+#define hash_of( ... )                 cc_hash_of( __VA_ARGS__ )
+#define erase( ... )                   cc_erase( __VA_ARGS__ )
+#define erase_n( ... )                 cc_erase_n( __VA_ARGS__ )
+#define erase_swap( ... )              cc_erase_swap( __VA_ARGS__ )
+#define erase_swap_n( ... )            cc_erase_swap_n( __VA_ARGS__ )
+#define erase_keys( ... )              cc_erase_keys( __VA_ARGS__ )
+#define erase_with_hash( ... )         cc_erase_with_hash( __VA_ARGS__ )
+#define erase_if( ... )                cc_erase_if( __VA_ARGS__ )
+#define erase_itr( ... )               cc_erase_itr( __VA_ARGS__ )
+#define clear( ... )                   cc_clear( __VA_ARGS__ ) 
+#define cleanup( ... )                 cc_cleanup( __VA_ARGS__ )
+#define first( ... )                   cc_first( __VA_ARGS__ )
+#define last( ... )                    cc_last( __VA_ARGS__ )
+#define r_end( ... )                   cc_r_end( __VA_ARGS__ )
+#define end( ... )                     cc_end( __VA_ARGS__ )
+#define next( ... )                    cc_next( __VA_ARGS__ )
+#define prev( ... )                    cc_prev( __VA_ARGS__ )
+#define for_each( ... )                cc_for_each( __VA_ARGS__ )
+#define r_for_each( ... )              cc_r_for_each( __VA_ARGS__ )
+#endif
+
+#ifndef CC_H
+#define CC_H
+
+#include <limits.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CC_VEC_VM_THRESHOLD
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+#include <type_traits>
+#endif
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                    Preliminary                                                     */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// _Static_assert alternative that can be used inside an expression.
+#define CC_STATIC_ASSERT( xp ) (void)sizeof( char[ (xp) ? 1 : -1 ] )
+
+// CC_MAKE_LVAL_COPY macro for making an addressable temporary copy of a variable or expression.
+// The copy is valid until at least the end of full expression surrounding the macro call.
+// In C, this is accomplished using a compound literal.
+// In C++, we use rvalue reference magic.
+// This is used to pass a pointers to elements and keys (which the user may have provided as rvalues) into container
+// functions.
+#ifdef __cplusplus
+template<class ty> ty& cc_unmove( ty&& var ) { return var; }
+#define CC_MAKE_LVAL_COPY( ty, xp ) cc_unmove( (ty)( xp ) )
+#else
+#define CC_MAKE_LVAL_COPY( ty, xp ) *( ty[ 1 ] ){ xp }
+#endif
+
+// Macro used primarily for silencing unused-expression warnings for macros that return cast pointers.
+// This issued seems to affect Clang in particular.
+// GCC, on the other hand, seems to accept that pointer casts may be redundant.
+#ifdef __cplusplus
+template<typename ty_1, typename ty_2> ty_1 cc_maybe_unused( ty_2 xp ){ return (ty_1)xp; }
+#define CC_CAST_MAYBE_UNUSED( ty, xp ) cc_maybe_unused<ty>( xp )
+#else
+#define CC_CAST_MAYBE_UNUSED( ty, xp ) ( ( ty ){ 0 } = ( (ty)( xp ) ) )
+#endif
+
+// CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2 is the same as above, except that it selects the type to which to cast based on
+// a condition.
+// This is neccessary because some API macros (e.g. cc_erase) return either a pointer-iterator or a bool depending on
+// the container type.
+
+#ifdef __cplusplus
+
+template<bool cond, class ty_1, class ty_2, class xp_ty, typename std::enable_if<cond, bool>::type = true> \
+ty_1 cc_if_then_cast_ty_1_else_cast_ty_2( xp_ty xp ){ return (ty_1)xp; }                                   \
+
+template<bool cond, class ty_1, class ty_2, class xp_ty, typename std::enable_if<!cond, bool>::type = true> \
+ty_2 cc_if_then_cast_ty_1_else_cast_ty_2( xp_ty xp ){ return (ty_2)xp; }                                    \
+
+#define CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2( cond, ty_1, ty_2, xp ) \
+cc_if_then_cast_ty_1_else_cast_ty_2<cond, ty_1, ty_2>( xp )         \
+
+#else
+
+#define CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2( cond, ty_1, ty_2, xp ) \
+CC_CAST_MAYBE_UNUSED(                                               \
+  CC_TYPEOF_XP(                                                     \
+    _Generic( (char (*)[ 1 + (bool)( cond ) ]){ 0 },                \
+        char (*)[ 1 ]: (ty_2){ 0 },                                 \
+        char (*)[ 2 ]: (ty_1){ 0 }                                  \
+    )                                                               \
+  ),                                                                \
+  ( xp )                                                            \
+)                                                                   \
+
+#endif
+
+// In GCC and Clang, we can generate a warning if the user passes an expression that may have side effects as the first
+// argument of API macros.
+// If the expression could have side effects, the compiler will not able able to resolve a comparision of it with itself
+// at compile time, which we can check using __builtin_constant_p.
+// The warning itself is generated via a division by zero.
+// This macro may produce false positives (e.g. for &our_containers[ our_func() ] where our_func is a pure function that
+// always returns the same value), but that is a reasonable price to pay for more macro safety.
+
+#ifdef __GNUC__
+
+#define CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr )                                                            \
+(void)(                                                                                                   \
+  "WARNING: CONTAINER ARGUMENT MAY HAVE DUPLICATED SIDE EFFECTS" &&1/__builtin_constant_p((cntr)==(cntr)) \
+)                                                                                                         \
+
+#else
+#define CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ) (void)0
+#endif
+
+// Typeof for expressions and abstract declarations.
+#ifdef __cplusplus
+#define CC_TYPEOF_XP( xp ) std::decay<std::remove_reference<decltype( xp )>::type>::type
+#define CC_TYPEOF_TY( ty ) std::decay<std::remove_reference<decltype( std::declval<ty>() )>::type>::type
+#else
+// TODO: Add C23 check once C23 is supported by major compilers.
+#define CC_TYPEOF_XP( xp ) __typeof__( xp )
+#define CC_TYPEOF_TY( ty ) __typeof__( ty )
+#endif
+
+// CC_SELECT_ON_NUM_ARGS macro for overloading API macros based on number of arguments.
+#define CC_CAT_2_( a, b ) a##b
+#define CC_CAT_2( a, b ) CC_CAT_2_( a, b )
+#define CC_N_ARGS_( _1, _2, _3, _4, _5, _6, n, ... ) n
+#define CC_N_ARGS( ... ) CC_N_ARGS_( __VA_ARGS__, _6, _5, _4, _3, _2, _1, x )
+#define CC_SELECT_ON_NUM_ARGS( func, ... ) CC_CAT_2( func, CC_N_ARGS( __VA_ARGS__ ) )( __VA_ARGS__ )
+
+// If the user has defined CC_REALLOC and CC_FREE, then CC_GET_REALLOC and CC_GET_FREE are replaced with those macros.
+// Otherwise, they are replaced by realloc and free from the standard library.
+#define CC_ARG_2_( _1, _2, ... ) _2
+#define CC_ARG_2( ... ) CC_ARG_2_( __VA_ARGS__ )
+#define CC_REALLOC_COMMA ,
+#define CC_REALLOC_FN CC_ARG_2( CC_CAT_2( CC_REALLOC, _COMMA ) realloc, CC_REALLOC, )
+#define CC_FREE_COMMA ,
+#define CC_FREE_FN CC_ARG_2( CC_CAT_2( CC_FREE, _COMMA ) free, CC_FREE, )
+
+// Macro used with CC_STATIC_ASSERT to provide type safety in cc_init_clone and cc_splice calls.
+#ifdef __cplusplus
+#define CC_IS_SAME_TY( a, b ) std::is_same<CC_TYPEOF_XP( a ), CC_TYPEOF_XP( b )>::value
+#else
+#define CC_IS_SAME_TY( a, b ) _Generic( (a), CC_TYPEOF_XP( b ): true, default: false )
+#endif
+
+// Macro for handling unused paramaters in most container functions that plug directly into API macros.
+// These functions must provide a standardized signature across containers.
+// The compiler should optimize away unused paramaters anyway, but we can nevertheless mark them as redundant.
+#ifdef __cplusplus
+#define CC_UNUSED( ty, name ) ty
+#else
+#ifdef __GNUC__
+#define CC_UNUSED( ty, name ) __attribute__((unused)) ty name
+#else
+#define CC_UNUSED( ty, name ) ty name
+#endif
+#endif
+
+// Macro for forcing the inlining of the functions that make up the map and set lookup and insertion paths.
+// These functions receive the hash and comparison functions as pointers, but the pointers are compile-time constants
+// selected by the API macros. Once a function is inlined into the API call site, the compiler can turn the indirect
+// calls into direct, inlined ones, yielding a probe loop specialized for the key type.
+// Without this attribute, GCC at -O2 frequently declines to inline these functions in larger translation units.
+#if defined( __GNUC__ ) && !defined( CC_NO_ALWAYS_INLINE )
+#define CC_ALWAYS_INLINE __attribute__((always_inline))
+#else
+#define CC_ALWAYS_INLINE
+#endif
+
+// Some functions that must return true/false must return the value in the form of a pointer.
+// This is because they are paired in ternary expressions inside API macros with other functions for other containers
+// that return a pointer (primarily cc_erase).
+// While any suitably aligned pointer - e.g. the container handle - would do, we declare a global cc_dummy_true_ptr for
+// the sake of code readability.
+static max_align_t cc_dummy_true;
+static void *cc_dummy_true_ptr = &cc_dummy_true;
+
+// Default max load factor for maps and sets.
+#define CC_DEFAULT_LOAD 0.75
+
+// Default max probe length for maps and sets, i.e. none.
+#define CC_DEFAULT_MAX_PROBELEN SIZE_MAX
+
+// Default min load factor for vectors, maps, and sets, i.e. no automatic shrinking.
+#define CC_DEFAULT_MIN_LOAD 0.0
+
+// Vector growth policy (see CC_GROWTH).
+typedef struct
+{
+  double factor;
+  size_t initial_cap;
+} cc_vec_growth_ty;
+
+// Default vector growth factor and initial capacity.
+#define CC_DEFAULT_GROWTH_FACTOR 2.0
+#define CC_DEFAULT_INITIAL_CAP   2
+
+// Returns the index of the lowest set bit in a non-zero bitmask.
+static inline unsigned int cc_ctz( uint64_t val )
+{
+#ifdef __GNUC__
+  return (unsigned int)__builtin_ctzll( val );
+#else
+  unsigned int result = 0;
+  while( !( val & 1 ) )
+  {
+    val >>= 1;
+    ++result;
+  }
+
+  return result;
+#endif
+}
+
+// Returns the number of zero bits above the highest set bit in a non-zero bitmask.
+static inline unsigned int cc_clz( uint64_t val )
+{
+#ifdef __GNUC__
+  return (unsigned int)__builtin_clzll( val );
+#else
+  unsigned int result = 0;
+  while( !( val & 0x8000000000000000ull ) )
+  {
+    val <<= 1;
+    ++result;
+  }
+
+  return result;
+#endif
+}
+
+// Types for comparison, hash, destructor, realloc, and free functions.
+// These are only for internal use as user-provided comparison, hash, and destructor have a different signature (see
+// documentation above).
+typedef int ( *cc_cmpr_fnptr_ty )( void *, void * );
+typedef size_t ( *cc_hash_fnptr_ty )( void * );
+typedef void ( *cc_dtor_fnptr_ty )( void * );
+typedef void *( *cc_realloc_fnptr_ty )( void *, size_t );
+typedef void ( *cc_free_fnptr_ty )( void * );
+
+// Types for the predicates passed to erase_if.
+// The API macro casts the user's predicate, which takes typed pointers, to cc_pred_fnptr_ty, and map functions cast it
+// back to cc_key_el_pred_fnptr_ty before calling it.
+// Both casts go through cc_generic_fnptr_ty, which compilers recognize as a generic function pointer type and therefore
+// do not flag under -Wcast-function-type.
+typedef void ( *cc_generic_fnptr_ty )( void );
+typedef bool ( *cc_pred_fnptr_ty )( void * );
+typedef bool ( *cc_key_el_pred_fnptr_ty )( void *, void * );
+
+// Swaps a block of memory (used for Robin-Hooding in maps and sets).
+// Implemented as a macro to ensure inlining.
+#define CC_MEMSWAP( a, b, size )                  \
+{                                                 \
+  char *aa = (char *)(a);                         \
+  char *bb = (char *)(b);                         \
+  size_t bytes_left = (size);                     \
+                                                  \
+  alignas( max_align_t ) char copy_buffer[ 256 ]; \
+                                                  \
+  while( bytes_left > 256 )                       \
+  {                                               \
+    memcpy( copy_buffer, aa, 256 );               \
+    memcpy( aa, bb, 256 );                        \
+    memcpy( bb, copy_buffer, 256 );               \
+    aa += 256;                                    \
+    bb += 256;                                    \
+    bytes_left -= 256;                            \
+  }                                               \
+                                                  \
+  memcpy( copy_buffer, aa, bytes_left );          \
+  memcpy( aa, bb, bytes_left );                   \
+  memcpy( bb, copy_buffer, bytes_left );          \
+}                                                 \
+/*
+static inline __attribute__((always_inline)) void cc_memswap( void *a, void *b, size_t size )
+{
+  alignas( max_align_t ) char copy_buffer[ 256 ];
+
+  char *aa = (char *)a;
+  char *bb = (char *)b;
+  while( size > 256 )
+  {
+    memcpy( copy_buffer, aa, 256 );
+    memcpy( aa, bb, 256 );
+    memcpy( bb, copy_buffer, 256 );
+    aa += 256;
+    bb += 256;
+    size -= 256;
+  }
+
+  memcpy( copy_buffer, aa, size );
+  memcpy( aa, bb, size );
+  memcpy( bb, copy_buffer, size );
+}
+
+static inline __attribute__((always_inline)) void cc_memswap2( void *a, void *b, size_t size_ab, void *c, void *d, size_t size_cd )
+{
+  alignas( max_align_t ) char copy_buffer[ 256 ];
+
+  char *aa = (char *)a;
+  char *bb = (char *)b;
+  while( size_ab > 256 )
+  {
+    memcpy( copy_buffer, aa, 256 );
+    memcpy( aa, bb, 256 );
+    memcpy( bb, copy_buffer, 256 );
+    aa += 256;
+    bb += 256;
+    size_ab -= 256;
+  }
+
+  memcpy( copy_buffer, aa, size_ab );
+  memcpy( aa, bb, size_ab );
+  memcpy( bb, copy_buffer, size_ab );
+
+  char *cc = (char *)c;
+  char *dd = (char *)d;
+  while( size_cd > 256 )
+  {
+    memcpy( copy_buffer, cc, 256 );
+    memcpy( cc, dd, 256 );
+    memcpy( dd, copy_buffer, 256 );
+    cc += 256;
+    bb += 256;
+    size_cd -= 256;
+  }
+
+  memcpy( copy_buffer, cc, size_cd );
+  memcpy( cc, dd, size_cd );
+  memcpy( dd, copy_buffer, size_cd );
+}*/
+
+// Container ids to identify container type at compile-time.
+#define CC_VEC  1
+#define CC_LIST 2
+#define CC_MAP  3
+#define CC_SET  4
+#define CC_OMAP 5
+#define CC_OSET 6
+#define CC_DMAP 7
+
+// Container ids occupy the low bits of the array dimension in a container's handle type (see CC_MAKE_CNTR_TY).
+// The remaining bits carry the number of elements for which a small vector makes its first allocation (see cc_svec).
+#define CC_CNTR_ID_BITS 3
+
+// Produces underlying function pointer type for a given element/key type pair.
+#define CC_MAKE_BASE_FNPTR_TY( el_ty, key_ty ) CC_TYPEOF_TY( CC_TYPEOF_TY( el_ty ) (*)( CC_TYPEOF_TY( key_ty )* ) )
+
+// Produces container handle for a given element type, key type, and container id.
+// In other words, this macro creates a pointer that carries all the information needed to identify and operate on a
+// container at compile time: el_ty (*(*)[ cntr_id ])( key_ty * ).
+// That is a pointer to an array of function pointers whose signature is el_ty ( key_ty * ).
+#define CC_MAKE_CNTR_TY( el_ty, key_ty, cntr_id ) CC_TYPEOF_TY( CC_MAKE_BASE_FNPTR_TY( el_ty, key_ty )(*)[ cntr_id ] )
+
+// API macros for declaring containers.
+// The key type is the type uses to lookup elements, even in nonassociative containers (e.g. a vector's key type is a
+// size_t array index).
+// This simplifies API macros by eliminating the need to treat non-associative containers as special cases.
+
+#define cc_vec( el_ty )         CC_MAKE_CNTR_TY( el_ty, size_t, CC_VEC )
+
+#define cc_svec( el_ty, n )     CC_MAKE_CNTR_TY( el_ty, size_t, CC_VEC | (size_t)( n ) << CC_CNTR_ID_BITS )
+
+#define cc_list( el_ty )        CC_MAKE_CNTR_TY( el_ty, void *, CC_LIST ) // List key is a pointer-iterator.
+
+#define cc_map( key_ty, el_ty ) CC_MAKE_CNTR_TY(                                                       \
+                                  el_ty,                                                               \
+                                  key_ty,                                                              \
+                                  CC_MAP * ( (                                                         \
+                                    /* Compiler error if key type lacks compare and hash functions. */ \
+                                    CC_HAS_CMPR( key_ty ) && CC_HAS_HASH( key_ty ) &&                  \
+                                    /* Compiler error if bucket layout constraints are violated. */    \
+                                    CC_SATISFIES_LAYOUT_CONSTRAINTS( key_ty, el_ty )                   \
+                                  ) ? 1 : -1 )                                                         \
+                                )                                                                      \
+
+#define cc_set( el_ty )         CC_MAKE_CNTR_TY(                                                                   \
+                                  /* As set simply wraps map, we use el_ty as both the element and key types. */   \
+                                  /* This allows minimal changes to map macros and functions to make sets work. */ \
+                                  el_ty,                                                                           \
+                                  el_ty,                                                                           \
+                                  CC_SET * ( (                                                                     \
+                                    /* Compiler error if key type lacks compare and hash functions. */             \
+                                    CC_HAS_CMPR( el_ty ) && CC_HAS_HASH( el_ty ) &&                                \
+                                    /* Compiler error if bucket layout constraints are violated. */                \
+                                    CC_SATISFIES_LAYOUT_CONSTRAINTS( el_ty, el_ty )                                \
+                                  ) ? 1 : -1 )                                                                     \
+                                )                                                                                  \
+
+#define cc_omap( key_ty, el_ty ) CC_MAKE_CNTR_TY(                                                                 \
+                                   el_ty,                                                                         \
+                                   key_ty,                                                                        \
+                                   CC_OMAP * ( (                                                                  \
+                                     /* Compiler error if key type lacks a compare function. */                   \
+                                     CC_HAS_CMPR( key_ty ) &&                                                     \
+                                     /* Compiler error if node layout constraints are violated. */                \
+                                     CC_SATISFIES_OMAP_LAYOUT_CONSTRAINTS( key_ty, el_ty )                        \
+                                   ) ? 1 : -1 )                                                                   \
+                                 )                                                                                \
+
+#define cc_oset( el_ty )         CC_MAKE_CNTR_TY(                                                                 \
+                                   /* As with set, we use el_ty as both the element and key types. */             \
+                                   el_ty,                                                                         \
+                                   el_ty,                                                                         \
+                                   CC_OSET * ( (                                                                  \
+                                     /* Compiler error if key type lacks a compare function. */                   \
+                                     CC_HAS_CMPR( el_ty ) &&                                                      \
+                                     /* Compiler error if node layout constraints are violated. */                \
+                                     CC_SATISFIES_OMAP_LAYOUT_CONSTRAINTS( el_ty, el_ty )                         \
+                                   ) ? 1 : -1 )                                                                   \
+                                 )                                                                                \
+
+#define cc_dmap( key_ty, el_ty ) CC_MAKE_CNTR_TY(                                                                 \
+                                   el_ty,                                                                         \
+                                   key_ty,                                                                        \
+                                   CC_DMAP * ( (                                                                  \
+                                     /* Compiler error if key type lacks compare and hash functions. */           \
+                                     CC_HAS_CMPR( key_ty ) && CC_HAS_HASH( key_ty ) &&                            \
+                                     /* Compiler error if entry layout constraints are violated. */               \
+                                     CC_SATISFIES_LAYOUT_CONSTRAINTS( key_ty, el_ty )                             \
+                                   ) ? 1 : -1 )                                                                   \
+                                 )                                                                                \
+
+// Retrieves a container's id (CC_VEC, CC_LIST, etc.) from its handle.
+#define CC_CNTR_ID( cntr ) ( sizeof( *cntr ) / sizeof( **cntr ) & ( ( 1 << CC_CNTR_ID_BITS ) - 1 ) )
+
+// Retrieves the number of elements for which a small vector makes its first allocation, or zero for any other
+// container.
+#define CC_SVEC_N( cntr ) ( sizeof( *cntr ) / sizeof( **cntr ) >> CC_CNTR_ID_BITS )
+
+// Retrieves a container's element type from its handle.
+#define CC_EL_TY( cntr ) CC_TYPEOF_XP( (**cntr)( NULL ) )
+
+// Easy access to a container's element and key sizes.
+#define CC_EL_SIZE( cntr )  sizeof( CC_EL_TY( cntr ) )
+
+// CC_KEY_TY macros for retrieving a container's key type from its handle (i.e. from the argument of the base function
+// pointer).
+#ifdef __cplusplus // For C++, this can be done easily with the help of a template function.
+
+template<typename el_ty, typename key_ty>
+key_ty cc_key_ty( el_ty (*)( key_ty * ) )
+{
+  key_ty dummy;
+  return dummy;
+}
+
+#define CC_KEY_TY( cntr ) CC_TYPEOF_XP( cc_key_ty( **cntr ) )
+
+#else // For C, we need to use _Generic trickery to match the base function pointer type with a key type previously
+      // coupled with a compare function.
+
+#define CC_KEY_TY_SLOT( n, arg ) CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( arg ), cc_cmpr_##n##_ty ): ( cc_cmpr_##n##_ty ){ 0 },
+#define CC_KEY_TY( cntr )                                                                         \
+CC_TYPEOF_XP(                                                                                     \
+  _Generic( (**cntr),                                                                             \
+    CC_FOR_EACH_CMPR( CC_KEY_TY_SLOT, cntr )                                                      \
+    default: _Generic( (**cntr),                                                                  \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), char ):               ( char ){ 0 },               \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned char ):      ( unsigned char ){ 0 },      \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), signed char ):        ( signed char ){ 0 },        \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned short ):     ( unsigned short ){ 0 },     \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), short ):              ( short ){ 0 },              \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned int ):       ( unsigned int ){ 0 },       \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), int ):                ( int ){ 0 },                \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned long ):      ( unsigned long ){ 0 },      \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), long ):               ( long ){ 0 },               \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), unsigned long long ): ( unsigned long long ){ 0 }, \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), long long ):          ( long long ){ 0 },          \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), cc_maybe_size_t ):    ( size_t ){ 0 },             \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), char * ):             ( char * ){ 0 },             \
+      CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( cntr ), void * ):             ( void * ){ 0 },             \
+      default: (char){ 0 } /* Nothing */                                                          \
+    )                                                                                             \
+  )                                                                                               \
+)                                                                                                 \
+
+#endif
+
+// Probe length type for maps and sets (Robin Hood hash tables).
+// An unsigned char would probably be fine, but we use unsigned int by default just in case.
+// A probe length of 0 denotes an empty bucket, whereas a probe length of 1 denotes an element in its home bucket.
+// This optimization allows us to eliminate separate checks for empty buckets.
+// If CC_SMALL_PROBELEN is defined, an unsigned char is used and probe lengths are capped at CC_MAP_PROBELEN_LIMIT.
+// The cap is one less than UCHAR_MAX so that a probe loop can step one bucket past the longest probe length without its
+// counter wrapping around to zero.
+// Because a Robin Hood insertion raises the longest probe length in a table by at most one, the cap is respected as
+// long as no element is inserted into a table whose max_probelen has already reached it (see cc_map_insert_hashed).
+// Growing a table never lengthens any probe, so only insertions and shrinking need to be guarded.
+#ifdef CC_SMALL_PROBELEN
+typedef unsigned char cc_probelen_ty;
+#define CC_MAP_PROBELEN_LIMIT ( UCHAR_MAX - 1 )
+#define CC_MAP_MAX_FORCED_GROWTHS 4
+#else
+typedef unsigned int cc_probelen_ty;
+#endif
+
+// The functions associated with some containers require extra information about how elements and/or keys and other data
+// are laid out in memory.
+// In particular, maps and sets need information about their bucket layouts, which depend on their element and/or key
+// types, ordered maps and sets need the maximum number of elements per node, which depends on the same types, and dense
+// maps need the layout of the entries in their element arrays.
+// This data is formed by extracting the key size and alignment and passing it, along with the element size and
+// alignment and the container type id, into the cc_layout function, which returns a uint64_t describing the layout.
+// The key size and alignment are inferred via a _Generic macro that looks up the key type based on the default
+// or user-supplied comparison functions, since all containers that require layout information also require a comparison
+// function.
+// Although this mechanism is convoluted, it has proven to compile much faster than other approaches (e.g. calculating
+// the layout inside a _Generic macro).
+// The compiler should optimize the entire mechanism into compile-time constants.
+
+// The layout for a map bucket is:
+//   +------------+----+------------+----+------------+----+
+//   |     #1     | #2 |     #3     | #4 |     #5     | #6 |
+//   +------------+----+------------+----+------------+----+
+//   #1 Element.
+//   #2 Element padding to key_ty alignment.
+//   #3 Key.
+//   #4 Key padding to cc_probelen_ty alignment.
+//   #5 Probe length.
+//   #6 #5 Probe length padding to largerst of el_ty, key_ty, and cc_probelen_ty alignments.
+
+// The layout for a set bucket is:
+//   +------------+----+------------+----+
+//   |     #1     | #2 |     #3     | #4 |
+//   +------------+----+------------+----+
+//   #1 Element (el_ty and key_ty are the same).
+//   #2 Padding to cc_probelen_ty alignment.
+//   #3 Probe length.
+//   #4 Padding to el_ty alignment.
+
+// If the CC_STORE_HASH flag is set for the key type, the bucket array is followed by an array containing the hash of
+// each bucket's key.
+// If the CC_METADATA flag is set for the key type, the bucket array (and hash array, if any) is followed by a metadata
+// array containing one byte per bucket (see the Map section below).
+
+// If the CC_SOA flag is set for a map's key type, the buckets are instead split across three arrays:
+//   +------------------+----+------------------+----+------------------+
+//   |        #1        | #2 |        #3        | #4 |        #5        |
+//   +------------------+----+------------------+----+------------------+
+//   #1 cap probe lengths.
+//   #2 Padding to max_align_t alignment.
+//   #3 cap keys.
+//   #4 Padding to max_align_t alignment.
+//   #5 cap elements.
+// For a set, the element array is empty and the key array doubles as the element array.
+// In this case, the padding values in the layout descriptor are unused.
+
+// The layout data passed into a container function is a uint64_t composed of a uint32_t denoting the key size, a
+// uint8_t denoting the padding after the element, a uint8_t denoting the padding after the key, a uint8_t denoting the
+// padding after the probe length, and a uint8_t containing the flags associated with the key type via CC_FLAGS.
+// The reason that a uint64_t, rather than a struct, is used is that GCC has trouble properly optimizing the passing
+// of the struct - even if only 8 bytes - into some container functions (specifically cc_map_insert), apparently because
+// it declines to pass the struct by register.
+
+// Macro for ensuring valid layout on container declaration.
 // Since the key size is four bytes and the padding values each one bytes, the key size must be <= UINT32_MAX (about
 // 4.3GB) and the alignment of the element and key must be <= UINT8_MAX + 1 (i.e. 256).
 // It unlikely that these constraints could be violated, but we can check anyway.
 #define CC_SATISFIES_LAYOUT_CONSTRAINTS( key_ty, el_ty )                                                      \
 ( sizeof( key_ty ) <= UINT32_MAX && alignof( el_ty ) <= UINT8_MAX + 1 && alignof( key_ty ) <= UINT8_MAX + 1 ) \
 
-// Macros and functions for constructing a layout.
+// The arrays inside an ordered map's node are aligned to max_align_t, so the key and element alignments cannot exceed
+// it.
+#define CC_SATISFIES_OMAP_LAYOUT_CONSTRAINTS( key_ty, el_ty )                          \
+( sizeof( key_ty ) <= UINT32_MAX && alignof( el_ty ) <= alignof( max_align_t ) && \
+  alignof( key_ty ) <= alignof( max_align_t ) )                                   \
+
+// Macros and functions for constructing a layout.
+
+#define CC_PADDING( size, align ) ( ( ~(size) + 1 ) & ( (align) - 1 ) )
+#define CC_MAX( a, b ) ( (a) > (b) ? (a) : (b) )
+#define CC_MIN( a, b ) ( (a) < (b) ? (a) : (b) )
+
+#define CC_MAP_EL_PADDING( el_size, key_align ) \
+CC_PADDING( el_size, key_align )                \
+
+#define CC_MAP_KEY_PADDING( el_size, key_size, key_align )                                            \
+CC_PADDING( el_size + CC_MAP_EL_PADDING( el_size, key_align ) + key_size, alignof( cc_probelen_ty ) ) \
+
+#define CC_MAP_PROBELEN_PADDING( el_size, el_align, key_size, key_align )        \
+CC_PADDING(                                                                      \
+  el_size + CC_MAP_EL_PADDING( el_size, key_align ) + key_size +                 \
+  CC_MAP_KEY_PADDING( el_size, key_size, key_align ) + sizeof( cc_probelen_ty ), \
+  CC_MAX( key_align, CC_MAX( el_align, alignof( cc_probelen_ty ) ) )             \
+)                                                                                \
+
+#define CC_SET_EL_PADDING( el_size )             \
+CC_PADDING( el_size, alignof( cc_probelen_ty ) ) \
+
+#define CC_SET_PROBELEN_PADDING( el_size, el_align )                 \
+CC_PADDING(                                                          \
+  el_size + CC_SET_EL_PADDING( el_size ) + sizeof( cc_probelen_ty ), \
+  CC_MAX( el_align, alignof( cc_probelen_ty ) )                      \
+)                                                                    \
+
+#define CC_DMAP_ENTRY_PADDING( el_size, el_align, key_size, key_align ) \
+CC_PADDING(                                                             \
+  el_size + CC_MAP_EL_PADDING( el_size, key_align ) + key_size,         \
+  CC_MAX( key_align, el_align )                                         \
+)                                                                       \
+
+// Target size in bytes of an ordered map or set node (see the Ordered map section below).
+#define CC_OMAP_NODE_SIZE_TARGET 512
+
+// The maximum number of elements in an ordered map or set node is as many as fit into the target node size alongside
+// their child indices, after setting aside room for the node header and the padding between the node's arrays, but no
+// fewer than three (the smallest maximum that a B-tree can support).
+#define CC_OMAP_MAX_KEYS_FOR( el_size, key_size )                                                             \
+CC_MAX(                                                                                                       \
+  ( CC_OMAP_NODE_SIZE_TARGET - 4 * alignof( max_align_t ) ) / ( (key_size) + (el_size) + sizeof( uint32_t ) ), \
+  3                                                                                                           \
+)                                                                                                             \
+
+// Struct for conveying key information from _Generic macro into below function.
+typedef struct
+{
+  uint64_t size;
+  uint64_t align;
+} cc_key_details_ty;
+
+// Function for creating the uint64_t layout descriptor.
+// This function must be inlined in order for layout calculations to be optimized into a compile-time constant.
+#ifdef __GNUC__
+__attribute__((always_inline))
+#endif
+static inline uint64_t cc_layout(
+  size_t cntr_id,
+  uint64_t el_size,
+  uint64_t el_align,
+  cc_key_details_ty key_details,
+  uint64_t key_flags
+)
+{
+  if( cntr_id == CC_MAP )
+    return
+      key_details.size                                                                        |
+      CC_MAP_EL_PADDING( el_size, key_details.align )                                   << 32 |
+      CC_MAP_KEY_PADDING( el_size, key_details.size, key_details.align )                << 40 |
+      CC_MAP_PROBELEN_PADDING( el_size, el_align, key_details.size, key_details.align ) << 48 |
+      ( key_flags & 0xFF )                                                              << 56;
+
+  if( cntr_id == CC_SET )
+    return
+      el_size                                            |
+      (uint64_t)0                                  << 32 |
+      CC_SET_EL_PADDING( el_size )                 << 40 |
+      CC_SET_PROBELEN_PADDING( el_size, el_align ) << 48 |
+      ( key_flags & 0xFF )                         << 56;
+
+  if( cntr_id == CC_OMAP )
+    return
+      key_details.size                                                   |
+      (uint64_t)CC_OMAP_MAX_KEYS_FOR( el_size, key_details.size ) << 32;
+
+  if( cntr_id == CC_OSET )
+    return
+      el_size                                                       |
+      (uint64_t)CC_OMAP_MAX_KEYS_FOR( (uint64_t)0, el_size ) << 32;
+
+  if( cntr_id == CC_DMAP )
+    return
+      key_details.size                                                                      |
+      CC_MAP_EL_PADDING( el_size, key_details.align )                                 << 32 |
+      CC_DMAP_ENTRY_PADDING( el_size, el_align, key_details.size, key_details.align ) << 40;
+
+  return 0; // Other container types don't require layout data.
+}
+
+// Macros for extracting data from layout descriptor.
+
+#define CC_KEY_SIZE( layout ) (uint32_t)( layout )
+
+#define CC_KEY_OFFSET( el_size, layout ) ( (el_size) + (uint8_t)( layout >> 32 ) )
+
+#define CC_PROBELEN_OFFSET( el_size, layout )                                           \
+( CC_KEY_OFFSET( el_size, layout ) + (uint32_t)( layout ) + (uint8_t)( layout >> 40 ) ) \
+
+#define CC_BUCKET_SIZE( el_size, layout )                                                        \
+( CC_PROBELEN_OFFSET( el_size, layout ) + sizeof( cc_probelen_ty ) + (uint8_t)( layout >> 48 ) ) \
+
+#define CC_HAS_FLAG( layout, flag ) ( ( (uint8_t)( layout >> 56 ) & (flag) ) != 0 )
+
+// For ordered maps and sets, the key size is followed by the maximum number of elements per node.
+
+#define CC_OMAP_MAX_KEYS( layout ) ( (uint16_t)( (layout) >> 32 ) )
+
+#define CC_OMAP_MIN_KEYS( layout ) ( CC_OMAP_MAX_KEYS( layout ) / 2 )
+
+// For dense maps, the key is instead followed by the padding at the end of each entry in the element array.
+
+#define CC_DMAP_ENTRY_SIZE( el_size, layout )                                           \
+( CC_KEY_OFFSET( el_size, layout ) + (uint32_t)( layout ) + (uint8_t)( layout >> 40 ) ) \
+
+// Return type for all functions that could reallocate a container's memory.
+// It contains a new container handle (the pointer may have changed to due reallocation) and an additional pointer whose
+// purpose depends on the function.
+// For functions that insert elements, that pointer points to the newly inserted elements, or NULL in the case of
+// allocation failure.
+// For other functions, that pointer is a dummy pointer that evaluates to true, or NULL in the case of allocation
+// failure (i.e. its only purpose is to convey whether the operation was successful).
+// The struct is aligned to max_align_t because the container handle must temporarily point to it (see
+// CC_POINT_HNDL_TO_ALLOCING_FN_RESULT below).
+typedef struct
+{
+  alignas( max_align_t )
+  void *new_cntr;
+  void *other_ptr;
+} cc_allocing_fn_result_ty;
+
+// Helper function for one-line cc_allocing_fn_result_ty.
+static inline cc_allocing_fn_result_ty cc_make_allocing_fn_result( void *new_cntr, void *other_ptr )
+{
+  cc_allocing_fn_result_ty result;
+  result.new_cntr = new_cntr;
+  result.other_ptr = other_ptr;
+  return result;
+}
+
+// Performs memcpy and returns ptr.
+// Used in conjunction with cc_allocing_fn_result_ty (see below).
+static inline void *cc_memcpy_and_return_ptr( void *dest, void *src, size_t size, void *ptr )
+{
+  memcpy( dest, src, size );
+  return ptr;
+}
+
+// All macros that call functions that could cause memory reallocation do two essential things to circumvent limitations
+// of ISO C (such as the inability to declare variables in expressions and _Thread_local linking issues).
+// Firstly, they temporarily set the container handle to point to a temporary cc_insert_result object returned by the
+// call to the function (see CC_MAKE_LVAL_COPY above).
+#define CC_POINT_HNDL_TO_ALLOCING_FN_RESULT( cntr, fn_call )                           \
+  cntr = (CC_TYPEOF_XP( cntr ))&CC_MAKE_LVAL_COPY( cc_allocing_fn_result_ty, fn_call ) \
+
+// Secondly, they call cc_memcpy_and_return_ptr to restore the correct container handle (a new pointer in the case of
+// reallocation) and return a pointer, either to any new elements or to signify success/failure, to the user.
+// (In the latter case, that pointer is cast to bool in the API macro before being passed to the user.)
+// Without this call, we would be unable to access the new elements/success-or-failure pointer stored in the
+// cc_allocing_fn_result_ty after restoring the correct container handle.
+// Note that outside the function, a temporary container handle is created from the new handle in the
+// cc_allocing_fn_result_ty so that the later (void *) is properly converted to the correct handle type.
+// This new, correctly typed handle is then memcpy-ed over the user-supplied handle inside the function.
+#define CC_FIX_HNDL_AND_RETURN_OTHER_PTR( cntr )                                              \
+cc_memcpy_and_return_ptr(                                                                     \
+  &cntr,                                                                                      \
+  &CC_MAKE_LVAL_COPY( CC_TYPEOF_XP( cntr ), ( (cc_allocing_fn_result_ty *)cntr )->new_cntr ), \
+  sizeof( cntr ),                                                                             \
+  ( (cc_allocing_fn_result_ty *)cntr )->other_ptr                                             \
+)                                                                                             \
+
+// The API macros that erase elements from vectors, maps, and sets (other than erase_itr) use the same mechanism to
+// shrink the container automatically if a min load factor is defined for its element or key type (see CC_MIN_LOAD).
+// They pass the result of the erasure, as other_ptr, through the container's auto-shrink function, which returns a
+// cc_allocing_fn_result_ty containing the possibly new container handle and other_ptr, adjusted if it is a vector
+// pointer-iterator.
+// Erasures that return a count pass a pointer to a copy of it (see CC_MAKE_LVAL_COPY).
+// This function is the auto-shrink function for containers that never shrink automatically.
+static inline cc_allocing_fn_result_ty cc_no_auto_shrink(
+  void *cntr,
+  void *other_ptr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( double, max_load ),
+  CC_UNUSED( double, min_load ),
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  CC_UNUSED( cc_realloc_fnptr_ty, realloc_ ),
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  return cc_make_allocing_fn_result( cntr, other_ptr );
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                      Vector                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// Vector header.
+typedef struct
+{
+  alignas( max_align_t )
+  size_t size;
+  size_t cap;
+} cc_vec_hdr_ty;
+
+// Global placeholder for vector with no allocated storage.
+// In the case of vectors, the placeholder allows us to avoid checking for a NULL container handle inside functions.
+static const cc_vec_hdr_ty cc_vec_placeholder = { 0, 0 };
+
+// Easy header access function for internal use.
+static inline cc_vec_hdr_ty *cc_vec_hdr( void *cntr )
+{
+  return (cc_vec_hdr_ty *)cntr;
+}
+
+static inline size_t cc_vec_size( void *cntr )
+{
+  return cc_vec_hdr( cntr )->size;
+}
+
+static inline size_t cc_vec_cap( void *cntr )
+{
+  return cc_vec_hdr( cntr )->cap;
+}
+
+static inline bool cc_vec_is_placeholder( void *cntr )
+{
+  return cc_vec_hdr( cntr )->cap == 0;
+}
+
+#ifdef CC_VEC_VM_THRESHOLD
+
+// Vectors whose memory reaches CC_VEC_VM_THRESHOLD bytes are backed by an anonymous memory mapping that reserves
+// CC_VEC_VM_RESERVE bytes of address space (or more, if the vector is already larger).
+// The operating system commits the mapping's pages lazily as elements are first written to them, so growth within the
+// reservation requires no system call and never moves the elements.
+// Growth beyond the reservation remaps the pages to a larger reservation (via mremap, without copying, on Linux when
+// it is available).
+// Because whether a vector is backed by a reservation is a function of its capacity and element size, no extra state is
+// stored in the vector header, and the API is unchanged.
+
+#ifndef CC_VEC_VM_RESERVE
+#define CC_VEC_VM_RESERVE ( (size_t)1 << ( sizeof( size_t ) >= 8 ? 36 : 28 ) )
+#endif
+
+#if !defined( MAP_ANONYMOUS ) && defined( MAP_ANON )
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#ifndef MAP_ANONYMOUS
+#error CC_VEC_VM_THRESHOLD requires MAP_ANONYMOUS (e.g. define _DEFAULT_SOURCE before #including any header)
+#endif
+
+#ifdef MAP_NORESERVE
+#define CC_VEC_VM_MAP_FLAGS ( MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE )
+#else
+#define CC_VEC_VM_MAP_FLAGS ( MAP_PRIVATE | MAP_ANONYMOUS )
+#endif
+
+// Header that precedes the vector header at the start of a reservation.
+typedef struct
+{
+  alignas( max_align_t )
+  size_t reserved; // Size of the mapping in bytes.
+} cc_vec_vm_hdr_ty;
+
+static inline bool cc_vec_is_vm( size_t cap, size_t el_size )
+{
+  return sizeof( cc_vec_hdr_ty ) + el_size * cap >= CC_VEC_VM_THRESHOLD;
+}
+
+// Rounds the size of the reservation needed to accommodate size bytes of vector memory up to a multiple of the page
+// size.
+static inline size_t cc_vec_vm_round( size_t size )
+{
+  size_t page_size = (size_t)sysconf( _SC_PAGESIZE );
+  return ( sizeof( cc_vec_vm_hdr_ty ) + size + page_size - 1 ) / page_size * page_size;
+}
+
+static inline cc_vec_vm_hdr_ty *cc_vec_vm_hdr( void *cntr )
+{
+  return (cc_vec_vm_hdr_ty *)cntr - 1;
+}
+
+// Creates a reservation for size bytes of vector memory.
+// Returns a pointer to the vector memory within the reservation, or NULL in the case of failure.
+static inline void *cc_vec_vm_map( size_t size )
+{
+  size_t reserved = cc_vec_vm_round( CC_MAX( size, CC_VEC_VM_RESERVE ) );
+  void *mapping = mmap( NULL, reserved, PROT_READ | PROT_WRITE, CC_VEC_VM_MAP_FLAGS, -1, 0 );
+
+  // If the address space or overcommit policy does not permit the full reservation, reserve only what is needed.
+  if( mapping == MAP_FAILED )
+  {
+    reserved = cc_vec_vm_round( size );
+    mapping = mmap( NULL, reserved, PROT_READ | PROT_WRITE, CC_VEC_VM_MAP_FLAGS, -1, 0 );
+    if( mapping == MAP_FAILED )
+      return NULL;
+  }
+
+  ( (cc_vec_vm_hdr_ty *)mapping )->reserved = reserved;
+  return (cc_vec_vm_hdr_ty *)mapping + 1;
+}
+
+static inline void cc_vec_vm_unmap( void *cntr )
+{
+  munmap( cc_vec_vm_hdr( cntr ), cc_vec_vm_hdr( cntr )->reserved );
+}
+
+// Resizes the vector memory within a reservation from old_size bytes to size bytes.
+// Shrinking releases the pages beyond the new size, and growth within the reservation only needs to let the operating
+// system commit pages as they are written, so in both cases the memory stays in place.
+// Returns a pointer to the vector memory, or NULL in the case of failure, in which case the reservation is unchanged.
+static inline void *cc_vec_vm_remap( void *cntr, size_t old_size, size_t size )
+{
+  cc_vec_vm_hdr_ty *vm_hdr = cc_vec_vm_hdr( cntr );
+
+  if( cc_vec_vm_round( size ) <= vm_hdr->reserved )
+  {
+    size_t end = cc_vec_vm_round( size );
+    size_t old_end = CC_MIN( cc_vec_vm_round( old_size ), vm_hdr->reserved );
+    if( end < old_end )
+    {
+      // A failure to release the pages is harmless because they remain valid memory.
+#if defined( __linux__ ) && defined( MADV_DONTNEED )
+      madvise( (char *)vm_hdr + end, old_end - end, MADV_DONTNEED );
+#else
+      mmap( (char *)vm_hdr + end, old_end - end, PROT_READ | PROT_WRITE, CC_VEC_VM_MAP_FLAGS | MAP_FIXED, -1, 0 );
+#endif
+    }
+
+    return cntr;
+  }
+
+  size_t reserved = CC_MAX( cc_vec_vm_round( size ), vm_hdr->reserved * 2 );
+
+#if defined( __linux__ ) && defined( MREMAP_MAYMOVE )
+  void *mapping = mremap( vm_hdr, vm_hdr->reserved, reserved, MREMAP_MAYMOVE );
+  if( mapping == MAP_FAILED )
+    return NULL;
+#else
+  void *mapping = mmap( NULL, reserved, PROT_READ | PROT_WRITE, CC_VEC_VM_MAP_FLAGS, -1, 0 );
+  if( mapping == MAP_FAILED )
+    return NULL;
+
+  memcpy( mapping, vm_hdr, sizeof( cc_vec_vm_hdr_ty ) + CC_MIN( old_size, size ) );
+  munmap( vm_hdr, vm_hdr->reserved );
+#endif
+
+  ( (cc_vec_vm_hdr_ty *)mapping )->reserved = reserved;
+  return (cc_vec_vm_hdr_ty *)mapping + 1;
+}
+
+#endif
+
+// Returns a pointer-iterator to the element at a specified index.
+static inline void *cc_vec_get(
+  void *cntr,
+  void *key, /* Pointer to size_t index */
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr )
+)
+{
+  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * *(size_t *)key;
+}
+
+// Returns the capacity of a vector whose memory was just allocated to accommodate n elements.
+// If CC_USABLE_SIZE is defined, this capacity includes any extra elements that fit in the memory that the allocator
+// actually provided.
+// If the memory lies in a reservation (see CC_VEC_VM_THRESHOLD), it includes any extra elements that fit in the last
+// page.
+static inline size_t cc_vec_cap_for_alloc( void *cntr, size_t n, size_t el_size )
+{
+  size_t usable = 0;
+
+#ifdef CC_VEC_VM_THRESHOLD
+  if( cc_vec_is_vm( n, el_size ) )
+    usable = cc_vec_vm_round( sizeof( cc_vec_hdr_ty ) + el_size * n ) - sizeof( cc_vec_vm_hdr_ty );
+  else
+#endif
+  {
+#ifdef CC_USABLE_SIZE
+    usable = CC_USABLE_SIZE( cntr );
+#ifdef CC_VEC_VM_THRESHOLD
+    // The capacity of memory from realloc_ must stay below the threshold, lest the vector appear to be reserved.
+    usable = CC_MIN( usable, (size_t)CC_VEC_VM_THRESHOLD - 1 );
+#endif
+#else
+    (void)cntr;
+#endif
+  }
+
+  usable = usable > sizeof( cc_vec_hdr_ty ) ? ( usable - sizeof( cc_vec_hdr_ty ) ) / el_size : 0;
+  return usable > n ? usable : n;
+}
+
+// Reallocates the memory of a vector, which may be the placeholder, to accommodate cap elements, preserving its header
+// and elements.
+// cap must not be less than the vector's size.
+// If CC_VEC_VM_THRESHOLD is defined and either the old or new memory reaches that threshold, the memory is moved into,
+// within, or out of a reservation instead of being reallocated via realloc_.
+// Returns a pointer to the new memory, or NULL in the case of allocation failure, in which case the vector is
+// unchanged.
+static inline cc_vec_hdr_ty *cc_vec_realloc(
+  void *cntr,
+  size_t cap,
+  size_t el_size,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  bool is_placeholder = cc_vec_is_placeholder( cntr );
+  size_t size = sizeof( cc_vec_hdr_ty ) + el_size * cap;
+
+#ifdef CC_VEC_VM_THRESHOLD
+  size_t old_size = sizeof( cc_vec_hdr_ty ) + el_size * cc_vec_cap( cntr );
+  bool was_vm = cc_vec_is_vm( cc_vec_cap( cntr ), el_size );
+  bool is_vm = cc_vec_is_vm( cap, el_size );
+
+  if( was_vm && is_vm )
+    return (cc_vec_hdr_ty *)cc_vec_vm_remap( cntr, old_size, size );
+
+  if( was_vm || is_vm )
+  {
+    void *new_cntr = is_vm ? cc_vec_vm_map( size ) : realloc_( NULL, size );
+    if( !new_cntr )
+      return NULL;
+
+    memcpy( new_cntr, cntr, sizeof( cc_vec_hdr_ty ) + el_size * cc_vec_size( cntr ) );
+
+    if( was_vm )
+      cc_vec_vm_unmap( cntr );
+    else if( !is_placeholder )
+      free_( cntr );
+
+    return (cc_vec_hdr_ty *)new_cntr;
+  }
+#else
+  (void)free_;
+#endif
+
+  return (cc_vec_hdr_ty *)realloc_( is_placeholder ? NULL : cntr, size );
+}
+
+// Frees the memory of a vector that is not the placeholder.
+static inline void cc_vec_free( void *cntr, size_t el_size, cc_free_fnptr_ty free_ )
+{
+#ifdef CC_VEC_VM_THRESHOLD
+  if( cc_vec_is_vm( cc_vec_cap( cntr ), el_size ) )
+  {
+    cc_vec_vm_unmap( cntr );
+    return;
+  }
+#else
+  (void)el_size;
+#endif
+
+  free_( cntr );
+}
+
+// Ensures that the capacity is large enough to support n elements without reallocation.
+// Returns a cc_allocing_fn_result_ty containing the new handle and a pointer that evaluates to true if the operation
+// was successful.
+static inline cc_allocing_fn_result_ty cc_vec_reserve(
+  void *cntr,
+  size_t n,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( double, max_load ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_vec_cap( cntr ) >= n )
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  bool is_placeholder = cc_vec_is_placeholder( cntr );
+
+  cc_vec_hdr_ty *new_cntr = cc_vec_realloc( cntr, n, el_size, realloc_, free_ );
+
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  if( is_placeholder )
+    new_cntr->size = 0;
+
+  new_cntr->cap = cc_vec_cap_for_alloc( new_cntr, n, el_size );
+  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+}
+
+// Returns the capacity to which a vector with capacity cap must grow to accommodate n elements, according to the growth
+// policy associated with its element type.
+// The first allocation has the policy's initial capacity, and each subsequent growth multiplies the capacity by the
+// policy's growth factor (by at least one element), until the capacity is large enough.
+static inline size_t cc_vec_growth_cap( size_t cap, size_t n, const cc_vec_growth_ty *growth )
+{
+  if( !cap )
+    cap = CC_MAX( growth->initial_cap, 1 );
+
+  while( cap < n )
+  {
+    size_t new_cap = (size_t)( cap * growth->factor );
+    cap = new_cap > cap ? new_cap : cap + 1;
+  }
+
+  return cap;
+}
+
+// Returns the growth policy of a vector declared via svec with n elements, i.e. that of its element type but with an
+// initial capacity of n, or the unmodified growth policy of its element type if n is zero, i.e. if it was declared via
+// vec.
+static inline cc_vec_growth_ty cc_vec_svec_growth( cc_vec_growth_ty growth, size_t n )
+{
+  if( n )
+    growth.initial_cap = n;
+
+  return growth;
+}
+
+// Inserts elements at the specified index.
+// If els is NULL, the new elements are left uninitialized for the caller to construct in place.
+// Returns a cc_allocing_fn_result_ty containing the new handle and a pointer-iterator to the newly inserted elements.
+// If the underlying storage needed to be expanded and an allocation failure occurred, or if n is zero, the latter
+// pointer will be NULL.
+static inline cc_allocing_fn_result_ty cc_vec_insert_n(
+  void *cntr,
+  size_t index,
+  void *els,
+  size_t n,
+  size_t el_size,
+  const cc_vec_growth_ty *growth,
+  void *( *realloc_ )( void *, size_t ),
+  void ( *free_ )( void * )
+)
+{
+  if( n == 0 )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  if( cc_vec_size( cntr ) + n > cc_vec_cap( cntr ) )
+  {
+    size_t cap = cc_vec_growth_cap( cc_vec_cap( cntr ), cc_vec_size( cntr ) + n, growth );
+
+    cc_allocing_fn_result_ty result = cc_vec_reserve(
+      cntr,
+      cap,
+      el_size,
+      0, // Dummy.
+      NULL,            // Dummy.
+      0.0,             // Dummy.
+      realloc_,
+      free_
+    );
+    if( !result.other_ptr )
+      return result;
+
+    cntr = result.new_cntr;
+  }
+
+  char *new_els = (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+  memmove( new_els + n * el_size, new_els, el_size * ( cc_vec_hdr( cntr )->size - index ) );
+  if( els )
+    memcpy( new_els, els, el_size * n );
+
+  cc_vec_hdr( cntr )->size += n;
+
+  return cc_make_allocing_fn_result( cntr, new_els );
+}
+
+static inline cc_allocing_fn_result_ty cc_vec_insert(
+  void *cntr,
+  void *el,
+  void *key, // Pointer to size_t index.
+  CC_UNUSED( bool, replace ),
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
+  CC_UNUSED( double, max_load ),
+  CC_UNUSED( size_t, max_probelen ),
+  const cc_vec_growth_ty *growth,
+  CC_UNUSED( cc_dtor_fnptr_ty, el_dtor ),
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_vec_insert_n( cntr, *(size_t *)key, el, 1, el_size, growth, realloc_, free_ );
+}
+
+static inline cc_allocing_fn_result_ty cc_vec_push_n(
+  void *cntr,
+  void *els,
+  size_t n,
+  size_t el_size,
+  const cc_vec_growth_ty *growth,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_vec_insert_n( cntr, cc_vec_size( cntr ), els, n, el_size, growth, realloc_, free_ );
+}
+
+static inline cc_allocing_fn_result_ty cc_vec_push(
+  void *cntr,
+  void *el,
+  size_t el_size,
+  const cc_vec_growth_ty *growth,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_vec_push_n( cntr, el, 1, el_size, growth, realloc_, free_ );
+}
+
+// Erases n elements at the specified index.
+// Returns a pointer-iterator to the element after the erased elements, or an end pointer-iterator if there is no
+// subsequent element.
+static inline void *cc_vec_erase_n(
+  void *cntr,
+  size_t index,
+  size_t n,
+  size_t el_size,
+  cc_dtor_fnptr_ty el_dtor
+)
+{
+  if( n == 0 )
+    return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+
+  if( el_dtor )
+    for( size_t j = 0; j < n; ++j )
+      el_dtor( (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( index + j ) );
+
+  memmove(
+    (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index,
+    (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( index + n ),
+    ( cc_vec_hdr( cntr )->size - n - index ) * el_size
+  );
+
+  cc_vec_hdr( cntr )->size -= n;
+  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+}
+
+// Erases n elements at the specified index by moving the last n elements, or all elements after the erased ones if
+// there are fewer, into the gap.
+// This avoids moving the entire tail, at the cost of not preserving the order of the remaining elements.
+// Returns a pointer-iterator to the element now at the specified index, or an end pointer-iterator if there is no such
+// element.
+static inline void *cc_vec_erase_swap_n(
+  void *cntr,
+  size_t index,
+  size_t n,
+  size_t el_size,
+  cc_dtor_fnptr_ty el_dtor
+)
+{
+  if( n == 0 )
+    return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+
+  if( el_dtor )
+    for( size_t j = 0; j < n; ++j )
+      el_dtor( (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( index + j ) );
+
+  // The source and destination cannot overlap: either the moved elements begin at or after the end of the gap, or they
+  // are all the elements after the gap and are fewer than n.
+  size_t size = cc_vec_hdr( cntr )->size;
+  size_t to_move = size - index - n < n ? size - index - n : n;
+  memcpy(
+    (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index,
+    (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( size - to_move ),
+    to_move * el_size
+  );
+
+  cc_vec_hdr( cntr )->size -= n;
+  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+}
+
+// Erases all elements for which pred returns true, calling their destructors if necessary, in a single pass that moves
+// each remaining element directly to its final position.
+// Each run of consecutive remaining elements is moved with one memmove rather than element by element, and the elements
+// before the first erased element are not moved at all.
+// The order of the remaining elements is preserved.
+// Returns the number of elements erased.
+static inline size_t cc_vec_erase_if(
+  void *cntr,
+  cc_pred_fnptr_ty pred,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  size_t size = cc_vec_size( cntr );
+  size_t kept = 0;
+  size_t run_begin = 0; // Index of the first element of the current run of remaining elements.
+
+  for( size_t i = 0; i < size; ++i )
+  {
+    void *el = (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * i;
+    if( !pred( el ) )
+      continue;
+
+    if( el_dtor )
+      el_dtor( el );
+
+    if( kept != run_begin )
+      memmove(
+        (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * kept,
+        (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * run_begin,
+        ( i - run_begin ) * el_size
+      );
+
+    kept += i - run_begin;
+    run_begin = i + 1;
+  }
+
+  if( kept != run_begin )
+    memmove(
+      (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * kept,
+      (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * run_begin,
+      ( size - run_begin ) * el_size
+    );
+
+  kept += size - run_begin;
+
+  if( kept != size ) // Also avoids writing to the placeholder.
+    cc_vec_hdr( cntr )->size = kept;
+
+  return size - kept;
+}
+
+// Shrinks vector's capacity to its current size.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
+// operation was successful and false in the case of allocation failure.
+static inline void *cc_vec_erase(
+  void *cntr,
+  void *key, // Pointer to size_t index.
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  return cc_vec_erase_n( cntr, *(size_t *)key, 1, el_size, el_dtor );
+}
+
+// Sets the number of elements in the vector.
+// If n is below the current size, then the destructor is called for all erased elements.
+// In this case, the vector's capacity is not changed.
+// If n is above the current size, the new elements are uninitialized.
+// Returns a cc_allocing_fn_result_ty containing new container handle and a pointer that evaluates to true if the
+// operation was successful and false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_vec_resize(
+  void *cntr,
+  size_t n,
+  size_t el_size,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  // No resize necessary (also handles placeholder).
+  if( n == cc_vec_size( cntr ) )
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  // Downsizing.
+  if( n < cc_vec_size( cntr ) )
+  {
+    cc_vec_erase_n( cntr, n, cc_vec_size( cntr ) - n, el_size, el_dtor );
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+  }
+
+  // Up-sizing.
+  cc_allocing_fn_result_ty result = cc_vec_reserve(
+    cntr,
+    n,
+    el_size,
+    0, // Dummy.
+    NULL,            // Dummy.
+    0.0,             // Dummy.
+    realloc_,
+    free_
+  );
+  if( !result.other_ptr )
+    return result;
+
+  cc_vec_hdr( result.new_cntr )->size = n;
+
+  return result;
+}
+
+static inline cc_allocing_fn_result_ty cc_vec_shrink(
+  void *cntr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( double, max_load ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_vec_size( cntr ) == cc_vec_cap( cntr ) ) // Also handles placeholder.
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  if( cc_vec_size( cntr ) == 0 )
+  {
+    // Restore placeholder.
+    cc_vec_free( cntr, el_size, free_ );
+    return cc_make_allocing_fn_result( (void *)&cc_vec_placeholder, cc_dummy_true_ptr );
+  }
+
+  cc_vec_hdr_ty *new_cntr = cc_vec_realloc( cntr, cc_vec_size( cntr ), el_size, realloc_, free_ );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  cc_vec_hdr( new_cntr )->cap = cc_vec_cap_for_alloc( new_cntr, cc_vec_size( new_cntr ), el_size );
+  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+}
+
+// Auto-shrink function for vectors (see cc_no_auto_shrink).
+// If the vector's size has fallen below its capacity multiplied by min_load, capped at half the reciprocal of the
+// growth factor, its capacity shrinks to twice its size, but not below the initial capacity of the growth policy.
+// Because the vector is then half full, its size must halve again before the next shrink and double before the next
+// growth, and because growth leaves the vector at least as full as the reciprocal of the growth factor, its size must
+// also halve after growth before the next shrink.
+// If other_ptr is a pointer-iterator into the vector, the returned pointer-iterator points to the same element in the
+// new memory.
+// In the case of allocation failure, the vector is left unchanged.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_vec_auto_shrink(
+  void *cntr,
+  void *other_ptr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( double, max_load ),
+  double min_load,
+  const cc_vec_growth_ty *growth,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  // Also handles the placeholder and the default min load factor of zero.
+  if( cc_vec_size( cntr ) >= cc_vec_cap( cntr ) * CC_MIN( min_load, 0.5 / growth->factor ) )
+    return cc_make_allocing_fn_result( cntr, other_ptr );
+
+  size_t cap = CC_MAX( cc_vec_size( cntr ) * 2, growth->initial_cap );
+  if( cap >= cc_vec_cap( cntr ) )
+    return cc_make_allocing_fn_result( cntr, other_ptr );
+
+  char *els = (char *)cntr + sizeof( cc_vec_hdr_ty );
+  bool is_itr = (char *)other_ptr >= els && (char *)other_ptr <= els + el_size * cc_vec_size( cntr );
+  size_t offset = is_itr ? (size_t)( (char *)other_ptr - els ) : 0;
+
+  cc_vec_hdr_ty *new_cntr = cc_vec_realloc( cntr, cap, el_size, realloc_, free_ );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, other_ptr );
+
+  new_cntr->cap = cc_vec_cap_for_alloc( new_cntr, cap, el_size );
+
+  if( is_itr )
+    other_ptr = (char *)new_cntr + sizeof( cc_vec_hdr_ty ) + offset;
+
+  return cc_make_allocing_fn_result( new_cntr, other_ptr );
+}
+
+// Sorting.
+
+// Vectors with fewer elements than this are sorted via comparison even if their element type supports radix sorting,
+// as the cost of the radix sort's histograms and scratch buffer would dominate.
+#define CC_VEC_RADIX_SORT_MIN 256
+
+// Sorts n elements in place via insertion sort, which is stable and fast for small n.
+static inline void cc_vec_insertion_sort( char *els, size_t n, size_t el_size, cc_cmpr_fnptr_ty cmpr )
+{
+  for( size_t i = 1; i < n; ++i )
+    for( size_t j = i; j > 0 && cmpr( els + el_size * ( j - 1 ), els + el_size * j ) > 0; --j )
+      CC_MEMSWAP( els + el_size * ( j - 1 ), els + el_size * j, el_size );
+}
+
+// Sorts n elements in place via heapsort, which guarantees O(n log n) time when quicksort partitioning degrades.
+static inline void cc_vec_heap_sort( char *els, size_t n, size_t el_size, cc_cmpr_fnptr_ty cmpr )
+{
+  for( size_t start = n / 2, end = n; end > 1; )
+  {
+    // The first phase builds the max-heap, and the second repeatedly moves its root behind the shrinking heap.
+    if( start > 0 )
+      --start;
+    else
+    {
+      --end;
+      CC_MEMSWAP( els, els + el_size * end, el_size );
+    }
+
+    // Sift the element at start down.
+    size_t root = start;
+    while( root * 2 + 1 < end )
+    {
+      size_t child = root * 2 + 1;
+      if( child + 1 < end && cmpr( els + el_size * child, els + el_size * ( child + 1 ) ) < 0 )
+        ++child;
+
+      if( cmpr( els + el_size * root, els + el_size * child ) >= 0 )
+        break;
+
+      CC_MEMSWAP( els + el_size * root, els + el_size * child, el_size );
+      root = child;
+    }
+  }
+}
+
+// Sorts n elements in place via introsort, i.e. quicksort with median-of-three pivots that falls back on heapsort once
+// depth_limit levels of partitioning have been exhausted and leaves partitions of 16 or fewer elements to insertion
+// sort.
+// The median-of-three step leaves elements no greater and no less than the pivot at either end of the partitioned
+// range, so they act as sentinels for the partitioning loops.
+static inline void cc_vec_intro_sort( char *els, size_t n, size_t el_size, cc_cmpr_fnptr_ty cmpr, size_t depth_limit )
+{
+  while( n > 16 )
+  {
+    if( depth_limit-- == 0 )
+    {
+      cc_vec_heap_sort( els, n, el_size, cmpr );
+      return;
+    }
+
+    // Order the second, middle, and last elements, then move the median (the middle) to the front as the pivot.
+    char *lo = els + el_size;
+    char *mid = els + el_size * ( n / 2 );
+    char *hi = els + el_size * ( n - 1 );
+    if( cmpr( mid, lo ) < 0 )
+      CC_MEMSWAP( mid, lo, el_size );
+    if( cmpr( hi, mid ) < 0 )
+    {
+      CC_MEMSWAP( hi, mid, el_size );
+      if( cmpr( mid, lo ) < 0 )
+        CC_MEMSWAP( mid, lo, el_size );
+    }
+    CC_MEMSWAP( els, mid, el_size );
+
+    // Hoare partitioning around the pivot, which stops on elements equal to it so that many equal elements still
+    // produce balanced partitions.
+    size_t i = 1;
+    size_t j = n - 1;
+    while( true )
+    {
+      while( cmpr( els + el_size * ++i, els ) < 0 );
+      while( cmpr( els, els + el_size * --j ) < 0 );
+      if( i >= j )
+        break;
+
+      CC_MEMSWAP( els + el_size * i, els + el_size * j, el_size );
+    }
+    CC_MEMSWAP( els, els + el_size * j, el_size );
+
+    // Recurse into the smaller partition and loop on the larger, bounding the stack depth at O(log n).
+    if( j < n - j - 1 )
+    {
+      cc_vec_intro_sort( els, j, el_size, cmpr, depth_limit );
+      els += el_size * ( j + 1 );
+      n -= j + 1;
+    }
+    else
+    {
+      cc_vec_intro_sort( els + el_size * ( j + 1 ), n - j - 1, el_size, cmpr, depth_limit );
+      n = j;
+    }
+  }
+
+  cc_vec_insertion_sort( els, n, el_size, cmpr );
+}
+
+// Returns the radix sort key of an integer element of width bytes, i.e. its value with the sign bit flipped if it is
+// signed, so that the keys of negative values sort below those of positive values.
+static inline CC_ALWAYS_INLINE uint64_t cc_vec_radix_key( const char *el, size_t width, bool is_signed )
+{
+  uint64_t key;
+  switch( width )
+  {
+    case 1:  { uint8_t val;  memcpy( &val, el, 1 ); key = val; break; }
+    case 2:  { uint16_t val; memcpy( &val, el, 2 ); key = val; break; }
+    case 4:  { uint32_t val; memcpy( &val, el, 4 ); key = val; break; }
+    default: { uint64_t val; memcpy( &val, el, 8 ); key = val; }
+  }
+
+  if( is_signed )
+    key ^= (uint64_t)1 << ( width * 8 - 1 );
+
+  return key;
+}
+
+// Sorts n integer elements of width bytes via a least-significant-digit radix sort with one-byte digits.
+// buffer is scratch space for n elements, and counts is space for eight 256-bucket histograms.
+// The histograms for all digits are computed in a single pass, and digits that are identical for all elements (e.g. the
+// upper bytes of small values) are skipped.
+// This function is always inlined so that each call site in cc_vec_radix_sort, where width is a constant, produces code
+// specialized for that width.
+static inline CC_ALWAYS_INLINE void cc_vec_radix_sort_width(
+  char *els,
+  char *buffer,
+  size_t ( *counts )[ 256 ],
+  size_t n,
+  size_t width,
+  bool is_signed
+)
+{
+  memset( counts, 0, sizeof( counts[ 0 ] ) * width );
+
+  for( size_t i = 0; i < n; ++i )
+  {
+    uint64_t key = cc_vec_radix_key( els + width * i, width, is_signed );
+    for( size_t digit = 0; digit < width; ++digit )
+      ++counts[ digit ][ key >> ( digit * 8 ) & 0xFF ];
+  }
+
+  char *src = els;
+  char *dest = buffer;
+  for( size_t digit = 0; digit < width; ++digit )
+  {
+    if( counts[ digit ][ cc_vec_radix_key( src, width, is_signed ) >> ( digit * 8 ) & 0xFF ] == n )
+      continue;
+
+    size_t offset = 0;
+    for( size_t bucket = 0; bucket < 256; ++bucket )
+    {
+      size_t count = counts[ digit ][ bucket ];
+      counts[ digit ][ bucket ] = offset;
+      offset += count;
+    }
+
+    for( size_t i = 0; i < n; ++i )
+    {
+      uint64_t key = cc_vec_radix_key( src + width * i, width, is_signed );
+      memcpy( dest + width * counts[ digit ][ key >> ( digit * 8 ) & 0xFF ]++, src + width * i, width );
+    }
+
+    char *temp = src;
+    src = dest;
+    dest = temp;
+  }
+
+  if( src != els )
+    memcpy( els, src, width * n );
+}
+
+// Sorts n integer elements as described by radix_key (see CC_EL_RADIX_KEY) via radix sort.
+// Returns false, without modifying the elements, in the case of memory allocation failure.
+static inline bool cc_vec_radix_sort(
+  char *els,
+  size_t n,
+  size_t radix_key,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t width = radix_key >> 1;
+  bool is_signed = radix_key & 1;
+
+  char *buffer = (char *)realloc_( NULL, width * n );
+  if( !buffer )
+    return false;
+
+  size_t counts[ 8 ][ 256 ];
+  switch( width )
+  {
+    case 1:  cc_vec_radix_sort_width( els, buffer, counts, n, 1, is_signed ); break;
+    case 2:  cc_vec_radix_sort_width( els, buffer, counts, n, 2, is_signed ); break;
+    case 4:  cc_vec_radix_sort_width( els, buffer, counts, n, 4, is_signed ); break;
+    default: cc_vec_radix_sort_width( els, buffer, counts, n, 8, is_signed );
+  }
+
+  free_( buffer );
+  return true;
+}
+
+// Sorts the vector's elements in ascending order.
+// If radix_key is nonzero, i.e. the element type is a fundamental integer type compared via the default comparison
+// function, and the vector is large enough, the elements are radix sorted using a scratch buffer.
+// Otherwise, or if allocating the scratch buffer fails, they are sorted in place via introsort, which calls cmpr.
+static inline void cc_vec_sort(
+  void *cntr,
+  size_t el_size,
+  cc_cmpr_fnptr_ty cmpr,
+  size_t radix_key,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  char *els = (char *)cntr + sizeof( cc_vec_hdr_ty );
+  size_t n = cc_vec_size( cntr );
+
+  if( radix_key && n >= CC_VEC_RADIX_SORT_MIN && cc_vec_radix_sort( els, n, radix_key, realloc_, free_ ) )
+    return;
+
+  size_t depth_limit = 0;
+  for( size_t i = n; i > 1; i /= 2 )
+    depth_limit += 2;
+
+  cc_vec_intro_sort( els, n, el_size, cmpr, depth_limit );
+}
+
+// Sorts the vector's elements in ascending order, preserving the relative order of equal elements.
+// The elements are sorted via a bottom-up merge sort, which calls cmpr and alternates between the vector's memory and a
+// scratch buffer, after runs of 32 elements have been insertion sorted in place.
+// Fundamental integer types are radix sorted exactly as by cc_vec_sort, as their equal elements are indistinguishable.
+// Returns false, without modifying the vector, in the case of memory allocation failure.
+static inline bool cc_vec_stable_sort(
+  void *cntr,
+  size_t el_size,
+  cc_cmpr_fnptr_ty cmpr,
+  size_t radix_key,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( radix_key )
+  {
+    cc_vec_sort( cntr, el_size, cmpr, radix_key, realloc_, free_ );
+    return true;
+  }
+
+  char *els = (char *)cntr + sizeof( cc_vec_hdr_ty );
+  size_t n = cc_vec_size( cntr );
+  size_t run = 32;
+
+  if( n <= run )
+  {
+    cc_vec_insertion_sort( els, n, el_size, cmpr );
+    return true;
+  }
+
+  char *buffer = (char *)realloc_( NULL, el_size * n );
+  if( !buffer )
+    return false;
+
+  for( size_t i = 0; i < n; i += run )
+    cc_vec_insertion_sort( els + el_size * i, CC_MIN( run, n - i ), el_size, cmpr );
+
+  char *src = els;
+  char *dest = buffer;
+  for( ; run < n; run *= 2 )
+  {
+    for( size_t lo = 0; lo < n; lo += run * 2 )
+    {
+      size_t mid = CC_MIN( lo + run, n );
+      size_t hi = CC_MIN( lo + run * 2, n );
+      size_t i = lo;
+      size_t j = mid;
+      size_t k = lo;
+
+      // Taking from the left run unless the right element is strictly less keeps the merge stable.
+      while( i < mid && j < hi )
+        if( cmpr( src + el_size * j, src + el_size * i ) < 0 )
+          memcpy( dest + el_size * k++, src + el_size * j++, el_size );
+        else
+          memcpy( dest + el_size * k++, src + el_size * i++, el_size );
+
+      memcpy( dest + el_size * k, src + el_size * i, el_size * ( mid - i ) );
+      k += mid - i;
+      memcpy( dest + el_size * k, src + el_size * j, el_size * ( hi - j ) );
+    }
+
+    char *temp = src;
+    src = dest;
+    dest = temp;
+  }
+
+  if( src != els )
+    memcpy( els, src, el_size * n );
+
+  free_( buffer );
+  return true;
+}
+
+// Initializes a shallow copy of the source vector.
+// The capacity of the new vector is the size of the source vector, not its capacity.
+// Returns a the pointer to the copy, or NULL in the case of allocation failure.
+// That return value is cast to bool in the corresponding macro.
+static inline void *cc_vec_init_clone(
+  void *src,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_vec_size( src ) == 0 )
+    return (void *)&cc_vec_placeholder;
+
+  cc_allocing_fn_result_ty result = cc_vec_resize(
+    (void *)&cc_vec_placeholder,
+    cc_vec_size( src ),
+    el_size,
+    NULL, // dtor unused.
+    realloc_,
+    free_
+  );
+
+  if( !result.other_ptr )
+    return NULL;
+
+  memcpy(
+    (char *)result.new_cntr + sizeof( cc_vec_hdr_ty ),
+    (char *)src + sizeof( cc_vec_hdr_ty ),
+    el_size * cc_vec_size( src )
+  );
+
+  return result.new_cntr;
+}
+
+// Erases all elements, calling their destructors if necessary.
+static inline void cc_vec_clear(
+  void *cntr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  cc_vec_erase_n( cntr, 0, cc_vec_size( cntr ), el_size, el_dtor );
+}
+
+// Clears the vector and frees its memory if it is not a placeholder.
+static inline void cc_vec_cleanup(
+  void *cntr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  cc_vec_clear(
+    cntr,
+    el_size,
+    0, // Dummy.
+    el_dtor,
+    NULL,            // Dummy.
+    NULL             // Dummy.
+  );
+
+  if( !cc_vec_is_placeholder( cntr ) )
+    cc_vec_free( cntr, el_size, free_ );
+}
+
+static inline void *cc_vec_end(
+  void *cntr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * cc_vec_size( cntr );
+}
+
+static inline void *cc_vec_next(
+  CC_UNUSED( void *, cntr ),
+  void *itr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return (char *)itr + el_size;
+}
+
+static inline void *cc_vec_first(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return (char *)cntr + sizeof( cc_vec_hdr_ty );
+}
+
+static inline void *cc_vec_last(
+  void *cntr,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( cc_vec_size( cntr ) - 1 );
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                        List                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// List is implemented a doubly linked list with sentinel nodes.
+
+// Node header.
+typedef struct cc_listnode_hdr_ty
+{
+  alignas( max_align_t )
+  struct cc_listnode_hdr_ty *prev;
+  struct cc_listnode_hdr_ty *next;
+} cc_listnode_hdr_ty;
+
+// List header.
+// It does not need to be aligned to alignof( max_align_t ) because no memory is allocated after the header.
+typedef struct
+{
+  size_t size;
+  cc_listnode_hdr_ty  r_end;
+  cc_listnode_hdr_ty  end;
+} cc_list_hdr_ty;
+
+// Placeholder for list with no allocated header.
+// The main purpose this serves is to provide every list with stable r_end and end iterators across translation units
+// and irrespective of whether any memory has been allocated for its header.
+// Every list initially (after cc_init) points to this placeholder, which differs across translation units, and is then
+// associated with that placeholder until cc_cleanup is called.
+// Calls to cc_r_end and cc_end on a list return pointers to the associated placeholder's r_end and end elements even
+// after a header has been dynamically allocated to it.
+// The way this works is that the placeholder's r_end.prev pointer points to the placeholder's r_end (i.e. a circular
+// link), and ditto for end.next.
+// Meanwhile, a list with an allocated header has it's r_end.prev pointer point to the placeholder's r_end, and ditto
+// for it's end.next pointer.
+// Therefore cc_list_hdr( cntr )->r_end.prev always produces the associated placeholder's r_end, and ditto for
+// cc_list_hdr( cntr )->end.next.
+// Unfortunately, this means that r_end and end must be handled as special cases during inserts, splices, and iteration.
+const static cc_list_hdr_ty cc_list_placeholder = {
+  0,
+  {
+    (cc_listnode_hdr_ty *)&cc_list_placeholder.r_end, // Circular link.
+    (cc_listnode_hdr_ty *)&cc_list_placeholder.end
+  },
+  {
+    (cc_listnode_hdr_ty *)&cc_list_placeholder.r_end,
+    (cc_listnode_hdr_ty *)&cc_list_placeholder.end    // Circular link.
+  }
+};
+
+// Easy access to list header.
+static inline cc_list_hdr_ty *cc_list_hdr( void *cntr )
+{
+  return (cc_list_hdr_ty *)cntr;
+}
+
+// Easy access to a list node header from a pointer-iterator.
+static inline cc_listnode_hdr_ty *cc_listnode_hdr( void *itr )
+{
+  return (cc_listnode_hdr_ty *)( (char *)itr - sizeof( cc_listnode_hdr_ty ) );
+}
+
+// Easy access to a pointer-iterator from pointer to a list node header.
+static inline void *cc_list_el( void *hdr )
+{
+  return (char *)hdr + sizeof( cc_listnode_hdr_ty );
+}
+
+static inline bool cc_list_is_placeholder( void *cntr )
+{
+  return cc_list_hdr( cntr )->r_end.prev == &cc_list_hdr( cntr )->r_end;
+}
+
+static inline size_t cc_list_size( void *cntr )
+{
+  return cc_list_hdr( cntr )->size;
+}
+
+static inline void *cc_list_r_end( void *cntr )
+{
+  return cc_list_el( cc_list_hdr( cntr )->r_end.prev );
+}
+
+static inline void *cc_list_end(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return cc_list_el( cc_list_hdr( cntr )->end.next );
+}
+
+static inline void *cc_list_prev(
+  void *cntr,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  cc_listnode_hdr_ty *prev = cc_listnode_hdr( itr )->prev;
+
+  // If itr is r_end, then we need to decrement the iterator once more to ensure that the returned iterator is the r_end
+  // of the placeholder originally associated with the list.
+  if( prev == &cc_list_hdr( cntr )->r_end )
+    prev = prev->prev;
+
+  return cc_list_el( prev );
+}
+
+static inline void *cc_list_next(
+  void *cntr,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  cc_listnode_hdr_ty *next = cc_listnode_hdr( itr )->next;
+
+  // See comment in cc_list_prev above.
+  if( next == &cc_list_hdr( cntr )->end )
+    next = next->next;
+
+  return cc_list_el( next );
+}
+
+static inline void *cc_list_first(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return cc_list_next(
+    cntr,
+    cc_list_el( &cc_list_hdr( cntr )->r_end ),
+    0,              // Dummy.
+    0 // Dummy.
+  );
+}
+
+static inline void *cc_list_last(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout )
+)
+{
+  return cc_list_prev(
+    cntr,
+    cc_list_el( &cc_list_hdr( cntr )->end ),
+    0,              // Dummy.
+    0 // Dummy.
+  );
+}
+
+// Allocates a header for a list that is currently a placeholder.
+// Returns the new container handle, or NULL in the case of allocation failure.
+static inline void *cc_list_alloc_hdr(
+  void *cntr,
+  cc_realloc_fnptr_ty realloc_
+)
+{
+  cc_list_hdr_ty *new_cntr = (cc_list_hdr_ty *)realloc_( NULL, sizeof( cc_list_hdr_ty ) );
+  if( !new_cntr )
+    return NULL;
+
+  new_cntr->r_end.next = &new_cntr->end;
+  new_cntr->end.prev = &new_cntr->r_end;
+
+  // Link the new header's r_end and end with the original placeholder's r_end and end.
+  new_cntr->r_end.prev = &cc_list_hdr( cntr )->r_end;
+  new_cntr->end.next = &cc_list_hdr( cntr )->end;
+
+  new_cntr->size = 0; 
+  return new_cntr;
+}
+
+// Attaches a node to the list before the node pointed to by the specified pointer-iterator.
+static inline void cc_list_attach( void *cntr, void *itr, cc_listnode_hdr_ty *node )
+{
+  // Handle r_end and end iterators as a special case.
+  // We need to convert the iterator from the global placeholder's r_end or end to the local r_end or end.
+  if( itr == cc_list_r_end( cntr ) )
+    itr = cc_list_el( &cc_list_hdr( cntr )->r_end );
+  else if( itr == cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ ) )
+    itr = cc_list_el( &cc_list_hdr( cntr )->end );
+
+  // Link node.
+  node->next = cc_listnode_hdr( itr );
+  node->prev = node->next->prev;
+  node->next->prev = node;
+  node->prev->next = node;
+}
+
+// Inserts an element into the list before the node pointed to by a given pointer-iterator.
+// If el is NULL, the new element is left uninitialized.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer-iterator to the newly inserted
+// element (or NULL in the case of allocation failure).
+static inline cc_allocing_fn_result_ty cc_list_insert(
+  void *cntr,
+  void *el,
+  void *key, // Pointer to void pointer-interator.
+  CC_UNUSED( bool, replace ),
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
+  CC_UNUSED( double, max_load ),
+  CC_UNUSED( size_t, max_probelen ),
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  CC_UNUSED( cc_dtor_fnptr_ty, el_dtor ),
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_realloc_fnptr_ty realloc_,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  if( cc_list_is_placeholder( cntr ) )
+  {
+    void *new_cntr = cc_list_alloc_hdr( cntr, realloc_ );
+    if( !new_cntr )
+      return cc_make_allocing_fn_result( cntr, NULL );
+
+    cntr = new_cntr;
+  }
+
+  cc_listnode_hdr_ty *new_node = (cc_listnode_hdr_ty *)realloc_( NULL, sizeof( cc_listnode_hdr_ty ) + el_size );
+  if( !new_node )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  if( el )
+    memcpy( cc_list_el( new_node ), el, el_size );
+
+  // Handle r_end and end iterators as a special case.
+  // We need to convert the iterator from the associated placeholder's r_end or end to the local r_end or end.
+  if( *(void **)key == cc_list_r_end( cntr ) )
+    *(void **)key = cc_list_el( &cc_list_hdr( cntr )->r_end );
+  else if( *(void **)key == cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ ) )
+    *(void **)key = cc_list_el( &cc_list_hdr( cntr )->end );
+
+  cc_list_attach( cntr, *(void **)key, new_node );
+
+  ++cc_list_hdr( cntr )->size;
+
+  return cc_make_allocing_fn_result( cntr, cc_list_el( new_node ) );  
+}
+
+static inline cc_allocing_fn_result_ty cc_list_push(
+  void *cntr,
+  void *el,
+  size_t el_size,
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  cc_realloc_fnptr_ty realloc_,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  return cc_list_insert(
+    cntr,
+    el,
+    &CC_MAKE_LVAL_COPY( void *, cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ ) ),
+    false,           // Dummy.
+    el_size,
+    0, // Dummy.
+    NULL,            // Dummy.
+    NULL,            // Dummy.
+    0.0,             // Dummy.
+    0,               // Dummy.
+    NULL,            // Dummy.
+    NULL,            // Dummy.
+    NULL,            // Dummy.
+    realloc_,
+    NULL             // Dummy.
+  );
+}
+
+// Erases the element pointed to by a given pointer-iterator and returns a pointer-iterator to next element (or end if
+// the element was the last element in the list).
+static inline void *cc_list_erase(
+  void *cntr,
+  void *key, // Pointer to void pointer-interator.
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout ),
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  cc_listnode_hdr_ty *hdr = cc_listnode_hdr( *(void **)key );
+  cc_listnode_hdr_ty *next = hdr->next;
+  hdr->prev->next = next;
+  next->prev = hdr->prev;
+  
+  if( el_dtor )
+    el_dtor( *(void **)key );
+
+  free_( hdr );
+  --cc_list_hdr( cntr )->size;
+
+  // If next is end, we need to make sure we're returning the associated placeholder's end.
+  if( next == &cc_list_hdr( cntr )->end )
+    next = next->next;
+
+  return cc_list_el( next );
+}
+
+// Removes the element pointed to by pointer-iterator src_itr from the source list and attaches it to the list before
+// pointer-iterator itr.
+// Although this function never allocates memory for the element/node itself, it must allocate the list's header if the
+// list is currently a placeholder.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
+// operation was successful or false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_list_splice(
+  void *cntr,
+  void *itr,
+  void *src,
+  void *src_itr,
+  cc_realloc_fnptr_ty realloc_
+)
+{
+  if( cc_list_is_placeholder( cntr ) )
+  {
+    void *new_cntr = cc_list_alloc_hdr( cntr, realloc_ );
+    if( !new_cntr )
+      return cc_make_allocing_fn_result( cntr, NULL );
+
+    cntr = new_cntr;
+  }
+
+  cc_listnode_hdr( src_itr )->prev->next = cc_listnode_hdr( src_itr )->next;
+  cc_listnode_hdr( src_itr )->next->prev = cc_listnode_hdr( src_itr )->prev;
+  cc_list_attach( cntr, itr, cc_listnode_hdr( src_itr ) );
+
+  --cc_list_hdr( src )->size;
+  ++cc_list_hdr( cntr )->size;
+
+  return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+}
+
+// Initializes a shallow copy of the source list.
+// This requires allocating memory for every node, as well as for the list's header unless src is a placeholder.
+// Returns a the pointer to the copy, or NULL in the case of allocation failure.
+// That return value is cast to bool in the corresponding macro.
+static inline void *cc_list_init_clone(
+  void *src,
+  size_t el_size,
+  CC_UNUSED( uint64_t, layout ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  cc_allocing_fn_result_ty result = { (void *)&cc_list_placeholder, cc_dummy_true_ptr };
+
+  for(
+    void *i = cc_list_first( src, 0 /* Dummy */, 0 /* Dummy */ );
+    i != cc_list_end( src, 0 /* Dummy */, 0 /* Dummy */ );
+    i = cc_list_next( src, i, 0 /* Dummy */, 0 /* Dummy */ )
+  )
+  {
+    result = cc_list_insert(
+      result.new_cntr,
+      i,
+      &CC_MAKE_LVAL_COPY(
+        void *,
+        cc_list_end( result.new_cntr, 0 /* Dummy */, 0 /* Dummy */ )
+      ),
+      false,           // Dummy.
+      el_size,
+      0, // Dummy.
+      NULL,            // Dummy.
+      NULL,            // Dummy.
+      0.0,             // Dummy.
+      0,               // Dummy.
+      NULL,            // Dummy.
+      NULL,            // Dummy.
+      NULL,            // Dummy.
+      realloc_,
+      NULL             // Dummy.
+    );
+
+    if( !result.other_ptr )
+    {
+      // Erase incomplete clone without invoking destructors.
+      
+      void *j = cc_list_first( result.new_cntr, 0 /* Dummy */, 0 /* Dummy */ );
+      while( j != cc_list_end( result.new_cntr, 0 /* Dummy */, 0 /* Dummy */ ) )
+      {
+        void *next = cc_list_next( result.new_cntr, j, 0 /* Dummy */, 0 /* Dummy */ );
+        free_( cc_listnode_hdr( j ) );
+        j = next;
+      }
+
+      if( !cc_list_is_placeholder( result.new_cntr ) )
+        free_( result.new_cntr );
+
+      return NULL;
+    }
+  }
+
+  return result.new_cntr;
+}
+
+// Erases all elements, calling their destructors if necessary.
+static inline void cc_list_clear(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout ),
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  while(
+    cc_list_first( cntr, 0 /* Dummy */, 0 /* Dummy */ ) !=
+    cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ )
+  )
+    cc_list_erase(
+      cntr,
+      &CC_MAKE_LVAL_COPY( void *, cc_list_first( cntr, 0 /* Dummy */, 0 /* Dummy */ ) ),
+      0,               // Dummy.
+      0, // Dummy.
+      NULL,            // Dummy.
+      NULL,            // Dummy.
+      el_dtor,
+      NULL,            // Dummy.
+      free_
+    );
+}
+
+// Erases all elements, calling their destructors if necessary, and frees memory for the list's header if it is not
+// a placeholder.
+static inline void cc_list_cleanup(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  CC_UNUSED( uint64_t, layout ),
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  cc_list_clear( cntr, 0 /* Dummy */, 0 /* Dummy */, el_dtor, NULL /* Dummy */, free_ );
+
+  if( !cc_list_is_placeholder( cntr ) )
+    free_( cntr );
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                        Map                                                         */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// Map header.
+// max_probelen is an upper bound on the probe length of any element in the map.
+// It is updated whenever an element is placed in a bucket and reset whenever the map is rehashed or cleared, but it is
+// not lowered when elements are erased.
+// old, migration_start, and migrated describe the old table during an incremental rehash (see below).
+// first and last are the indices of the first and last occupied buckets, or SIZE_MAX and zero if the table is empty.
+// Each table has its own header, and size denotes the number of elements in that table only.
+typedef struct
+{
+  alignas( max_align_t )
+  size_t size;
+  size_t cap;
+  size_t max_probelen;
+  void *old;
+  size_t migration_start;
+  size_t migrated;
+  size_t first;
+  size_t last;
+} cc_map_hdr_ty;
+
+// Placeholder for map with no allocated memory.
+// In the case of maps, this placeholder allows us to avoid checking for a NULL handle inside functions.
+static const cc_map_hdr_ty cc_map_placeholder = { 0, 0, 0, NULL, 0, 0, SIZE_MAX, 0 };
+
+// Easy header access function for internal use.
+static inline cc_map_hdr_ty *cc_map_hdr( void *cntr )
+{
+  return (cc_map_hdr_ty *)cntr;
+}
+
+// Size and capacity.
+
+// The size includes any elements not yet migrated from the old table.
+static inline size_t cc_map_size( void *cntr )
+{
+  if( cc_map_hdr( cntr )->old )
+    return cc_map_hdr( cntr )->size + cc_map_hdr( cc_map_hdr( cntr )->old )->size;
+
+  return cc_map_hdr( cntr )->size;
+}
+
+static inline size_t cc_map_cap( void *cntr )
+{
+  return cc_map_hdr( cntr )->cap;
+}
+
+static inline bool cc_map_is_placeholder( void *cntr )
+{
+  return cc_map_cap( cntr ) == 0;
+}
+
+// Functions for easily accessing element, key, and probe length for the bucket at index i.
+// The element pointer also denotes the beginning of the bucket.
+
+// If the CC_SOA flag is set, each "bucket" is instead spread across the probe-length, key, and element arrays, and the
+// element pointer is the pointer into the element array.
+
+// Rounds the size of an array in the SoA layout up to the alignment of the next array.
+#define CC_SOA_ARRAY_SIZE( size ) ( (size) + CC_PADDING( (size), alignof( max_align_t ) ) )
+
+static inline CC_ALWAYS_INLINE void *cc_map_el( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  // A set's elements are its keys.
+  if( CC_HAS_FLAG( layout, CC_SOA ) && el_size == 0 )
+    return (char *)cntr + sizeof( cc_map_hdr_ty ) +
+      CC_SOA_ARRAY_SIZE( sizeof( cc_probelen_ty ) * cc_map_hdr( cntr )->cap ) +
+      CC_KEY_SIZE( layout ) * i;
+
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+    return (char *)cntr + sizeof( cc_map_hdr_ty ) +
+      CC_SOA_ARRAY_SIZE( sizeof( cc_probelen_ty ) * cc_map_hdr( cntr )->cap ) +
+      CC_SOA_ARRAY_SIZE( CC_KEY_SIZE( layout ) * cc_map_hdr( cntr )->cap ) +
+      el_size * i;
+
+  return (char *)cntr + sizeof( cc_map_hdr_ty ) + CC_BUCKET_SIZE( el_size, layout ) * i;
+}
+
+static inline CC_ALWAYS_INLINE void *cc_map_key( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+    return (char *)cntr + sizeof( cc_map_hdr_ty ) +
+      CC_SOA_ARRAY_SIZE( sizeof( cc_probelen_ty ) * cc_map_hdr( cntr )->cap ) +
+      CC_KEY_SIZE( layout ) * i;
+
+  return (char *)cc_map_el( cntr, i, el_size, layout ) + CC_KEY_OFFSET( el_size, layout );
+}
+
+static inline CC_ALWAYS_INLINE cc_probelen_ty *cc_map_probelen(
+  void *cntr,
+  size_t i,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+    return (cc_probelen_ty *)( (char *)cntr + sizeof( cc_map_hdr_ty ) ) + i;
+
+  return (cc_probelen_ty *)( (char *)cc_map_el( cntr, i, el_size, layout ) + CC_PROBELEN_OFFSET( el_size, layout ) );
+}
+
+// Returns the index of the bucket whose element is pointed to by pointer-iterator itr.
+static inline size_t cc_map_itr_index( void *cntr, void *itr, size_t el_size, uint64_t layout )
+{
+  if( CC_HAS_FLAG( layout, CC_SOA ) && el_size == 0 )
+    return ( (char *)itr - (char *)cc_map_key( cntr, 0, el_size, layout ) ) / CC_KEY_SIZE( layout );
+
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+    return ( (char *)itr - (char *)cc_map_el( cntr, 0, el_size, layout ) ) / el_size;
+
+  return ( (char *)itr - (char *)cc_map_el( cntr, 0, el_size, layout ) ) / CC_BUCKET_SIZE( el_size, layout );
+}
+
+// Raises the header's max_probelen to accommodate an element just placed with the specified probe length.
+static inline void cc_map_note_probelen( void *cntr, cc_probelen_ty probelen )
+{
+  if( probelen > cc_map_hdr( cntr )->max_probelen )
+    cc_map_hdr( cntr )->max_probelen = probelen;
+}
+
+// Metadata.
+// If the CC_METADATA flag is set for the key type, the bucket array is followed by an array of one-byte hash fragments,
+// one per bucket.
+// A fragment byte is zero for an empty bucket, or else seven bits of the element's hash with the high bit set.
+// Lookups load a whole group of fragment bytes at once and compare them against the fragment of the key being sought,
+// so that full keys - and the buckets themselves - are only accessed in the case of a fragment match.
+// The probe is bounded by the first empty bucket or the header's max_probelen, whichever comes first.
+// The first CC_META_GROUP_SIZE bytes are mirrored after the end of the array so that a group beginning near the end
+// can be loaded without wrapping around.
+
+#if defined( __AVX2__ )
+#define CC_META_GROUP_SIZE 32
+#elif defined( __SSE2__ )
+#define CC_META_GROUP_SIZE 16
+#else
+#define CC_META_GROUP_SIZE 8
+#endif
+
+// Number of 64-bit words in the occupancy bitmap of a map with capacity cap (see below).
+#define CC_MAP_OCCUPANCY_WORDS( cap ) ( ( ( cap ) + 63 ) / 64 )
+
+// Returns the total number of bytes that must be allocated for a map with capacity cap.
+static inline size_t cc_map_alloc_size( size_t cap, size_t el_size, uint64_t layout )
+{
+  size_t size;
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+    size = sizeof( cc_map_hdr_ty ) + CC_SOA_ARRAY_SIZE( sizeof( cc_probelen_ty ) * cap ) +
+      CC_SOA_ARRAY_SIZE( CC_KEY_SIZE( layout ) * cap ) + el_size * cap;
+  else
+    size = sizeof( cc_map_hdr_ty ) + CC_BUCKET_SIZE( el_size, layout ) * cap;
+
+  if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+    size += sizeof( size_t ) * cap;
+
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    size += cap + CC_META_GROUP_SIZE;
+
+  if( CC_HAS_FLAG( layout, CC_OCCUPANCY ) )
+    size += sizeof( uint64_t ) * CC_MAP_OCCUPANCY_WORDS( cap );
+
+  return size;
+}
+
+// Stored hashes.
+// If the CC_STORE_HASH flag is set for the key type, the bucket array is followed by an array containing the hash of
+// the key in each bucket.
+// Because the capacity is always a power of two no smaller than eight, the end of the bucket array is always suitably
+// aligned for size_t.
+
+static inline CC_ALWAYS_INLINE size_t *cc_map_hashes( void *cntr, size_t el_size, uint64_t layout )
+{
+  return (size_t *)cc_map_el( cntr, cc_map_hdr( cntr )->cap, el_size, layout );
+}
+
+// Returns true if the hash stored for the key in bucket i equals hash_val, or if the key type does not store hashes.
+// Comparing stored hashes allows us to skip most calls to the comparison function for keys that merely share a home
+// bucket or metadata fragment.
+static inline CC_ALWAYS_INLINE bool cc_map_hash_matches(
+  void *cntr,
+  size_t i,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  return !CC_HAS_FLAG( layout, CC_STORE_HASH ) || cc_map_hashes( cntr, el_size, layout )[ i ] == hash_val;
+}
+
+static inline CC_ALWAYS_INLINE unsigned char *cc_map_metadata( void *cntr, size_t el_size, uint64_t layout )
+{
+  if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+    return (unsigned char *)( cc_map_hashes( cntr, el_size, layout ) + cc_map_hdr( cntr )->cap );
+
+  return (unsigned char *)cc_map_el( cntr, cc_map_hdr( cntr )->cap, el_size, layout );
+}
+
+// Derives the fragment byte for a hash.
+// The hash is remixed with a Fibonacci multiplier before its highest bits are taken so that weak hash functions whose
+// upper bits barely vary (e.g. multiplicative hashes of small integers) still produce well-distributed fragments.
+static inline unsigned char cc_map_meta_frag( size_t hash_val )
+{
+  return (unsigned char)( ( (uint64_t)hash_val * 0x9E3779B97F4A7C15ull ) >> 57 ) | 0x80;
+}
+
+static inline void cc_map_set_meta( void *cntr, size_t i, unsigned char val, size_t el_size, uint64_t layout )
+{
+  unsigned char *meta = cc_map_metadata( cntr, el_size, layout );
+  size_t cap = cc_map_hdr( cntr )->cap;
+  meta[ i ] = val;
+
+  // Update mirrored bytes.
+  // If the capacity is less than the group size, one byte may be mirrored more than once.
+  if( i < CC_META_GROUP_SIZE )
+    for( size_t j = i + cap; j < cap + CC_META_GROUP_SIZE; j += cap )
+      meta[ j ] = val;
+}
+
+// Returns a bitmask denoting which of the CC_META_GROUP_SIZE bytes beginning at meta equal val.
+static inline CC_ALWAYS_INLINE uint64_t cc_map_meta_match( unsigned char *meta, unsigned char val )
+{
+#if defined( __AVX2__ )
+  return (uint32_t)_mm256_movemask_epi8(
+    _mm256_cmpeq_epi8( _mm256_loadu_si256( (const __m256i *)meta ), _mm256_set1_epi8( (char)val ) )
+  );
+#elif defined( __SSE2__ )
+  return (uint32_t)_mm_movemask_epi8(
+    _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i *)meta ), _mm_set1_epi8( (char)val ) )
+  );
+#else
+  uint64_t mask = 0;
+  for( int i = 0; i < CC_META_GROUP_SIZE; ++i )
+    mask |= (uint64_t)( meta[ i ] == val ) << i;
+
+  return mask;
+#endif
+}
+
+// Returns the index of the bucket containing the specified key, or the capacity if no such bucket exists, using the
+// metadata array.
+static inline CC_ALWAYS_INLINE size_t cc_map_meta_find(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  size_t cap = cc_map_hdr( cntr )->cap;
+  size_t home = hash_val & ( cap - 1 );
+  size_t max_probelen = cc_map_hdr( cntr )->max_probelen;
+  unsigned char frag = cc_map_meta_frag( hash_val );
+  unsigned char *meta = cc_map_metadata( cntr, el_size, layout );
+
+  for( size_t dist = 0; dist < max_probelen; dist += CC_META_GROUP_SIZE )
+  {
+    size_t group = ( home + dist ) & ( cap - 1 );
+    uint64_t matches = cc_map_meta_match( meta + group, frag );
+    uint64_t empties = cc_map_meta_match( meta + group, 0 );
+
+    // Disregard buckets beyond the max probe length and beyond the first empty bucket.
+    if( max_probelen - dist < CC_META_GROUP_SIZE )
+    {
+      matches &= ( (uint64_t)1 << ( max_probelen - dist ) ) - 1;
+      empties &= ( (uint64_t)1 << ( max_probelen - dist ) ) - 1;
+    }
+
+    if( empties )
+      matches &= ( empties & ( ~empties + 1 ) ) - 1;
+
+    while( matches )
+    {
+      size_t offset = cc_ctz( matches );
+      size_t i = ( group + offset ) & ( cap - 1 );
+
+      // The probe length check rules out elements with the same fragment that belong to a different home bucket.
+      if(
+        *cc_map_probelen( cntr, i, el_size, layout ) == dist + offset + 1 &&
+        cc_map_hash_matches( cntr, i, hash_val, el_size, layout ) &&
+        cmpr( cc_map_key( cntr, i, el_size, layout ), key ) == 0
+      )
+        return i;
+
+      matches &= matches - 1;
+    }
+
+    if( empties )
+      break;
+  }
+
+  return cap;
+}
+
+// Occupancy.
+// Every table tracks the indices of its first and last occupied buckets in its header (see above), so that first and
+// last are constant-time and iteration stops at the last occupied bucket rather than at the end of the bucket array.
+// If the CC_OCCUPANCY flag is set for the key type, the other arrays are also followed by a bitmap denoting which
+// buckets are occupied, and iteration scans this bitmap 64 buckets at a time.
+// Because the capacity is always a power of two no smaller than eight, the bitmap is always suitably aligned for
+// uint64_t.
+
+static inline CC_ALWAYS_INLINE uint64_t *cc_map_occupancy( void *cntr, size_t el_size, uint64_t layout )
+{
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    return (uint64_t *)( cc_map_metadata( cntr, el_size, layout ) + cc_map_hdr( cntr )->cap + CC_META_GROUP_SIZE );
+
+  if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+    return (uint64_t *)( cc_map_hashes( cntr, el_size, layout ) + cc_map_hdr( cntr )->cap );
+
+  return (uint64_t *)cc_map_el( cntr, cc_map_hdr( cntr )->cap, el_size, layout );
+}
+
+// Marks all buckets as empty.
+static inline void cc_map_reset_occupancy( void *cntr, size_t el_size, uint64_t layout )
+{
+  cc_map_hdr( cntr )->first = SIZE_MAX;
+  cc_map_hdr( cntr )->last = 0;
+
+  if( CC_HAS_FLAG( layout, CC_OCCUPANCY ) )
+    memset(
+      cc_map_occupancy( cntr, el_size, layout ),
+      0,
+      sizeof( uint64_t ) * CC_MAP_OCCUPANCY_WORDS( cc_map_hdr( cntr )->cap )
+    );
+}
+
+// Returns the index of the first occupied bucket in the specified table at or after index i, or SIZE_MAX if there is
+// no such bucket.
+static inline size_t cc_map_occupied_from( void *table, size_t i, size_t el_size, uint64_t layout )
+{
+  cc_map_hdr_ty *hdr = cc_map_hdr( table );
+  if( !hdr->size ) // Also handles placeholder.
+    return SIZE_MAX;
+
+  if( i < hdr->first )
+    i = hdr->first;
+
+  if( CC_HAS_FLAG( layout, CC_OCCUPANCY ) )
+  {
+    uint64_t *bits = cc_map_occupancy( table, el_size, layout );
+    while( i <= hdr->last )
+    {
+      uint64_t word = bits[ i / 64 ] >> ( i % 64 );
+      if( word )
+        return i + cc_ctz( word );
+
+      i = ( i | 63 ) + 1;
+    }
+  }
+  else
+    for( ; i <= hdr->last; ++i )
+      if( *cc_map_probelen( table, i, el_size, layout ) )
+        return i;
+
+  return SIZE_MAX;
+}
+
+// Returns the index of the last occupied bucket in the specified table before index i, or SIZE_MAX if there is no such
+// bucket.
+static inline size_t cc_map_occupied_before( void *table, size_t i, size_t el_size, uint64_t layout )
+{
+  cc_map_hdr_ty *hdr = cc_map_hdr( table );
+  if( !hdr->size ) // Also handles placeholder.
+    return SIZE_MAX;
+
+  if( i > hdr->last )
+    i = hdr->last + 1;
+
+  if( CC_HAS_FLAG( layout, CC_OCCUPANCY ) )
+  {
+    uint64_t *bits = cc_map_occupancy( table, el_size, layout );
+    while( i > hdr->first )
+    {
+      --i;
+      uint64_t word = bits[ i / 64 ] << ( 63 - i % 64 );
+      if( word )
+        return i - cc_clz( word );
+
+      i &= ~(size_t)63;
+    }
+  }
+  else
+    while( i > hdr->first )
+      if( *cc_map_probelen( table, --i, el_size, layout ) )
+        return i;
+
+  return SIZE_MAX;
+}
+
+// Records that bucket i, which was empty, is now occupied.
+static inline CC_ALWAYS_INLINE void cc_map_note_occupied( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  cc_map_hdr_ty *hdr = cc_map_hdr( cntr );
+  if( i < hdr->first )
+    hdr->first = i;
+
+  if( i > hdr->last )
+    hdr->last = i;
+
+  if( CC_HAS_FLAG( layout, CC_OCCUPANCY ) )
+    cc_map_occupancy( cntr, el_size, layout )[ i / 64 ] |= (uint64_t)1 << ( i % 64 );
+}
+
+// Records that bucket i, which was occupied, is now empty.
+// Must be called after the bucket's probe length has been zeroed and the table's size has been updated.
+static inline void cc_map_note_vacated( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  cc_map_hdr_ty *hdr = cc_map_hdr( cntr );
+
+  if( CC_HAS_FLAG( layout, CC_OCCUPANCY ) )
+    cc_map_occupancy( cntr, el_size, layout )[ i / 64 ] &= ~( (uint64_t)1 << ( i % 64 ) );
+
+  if( !hdr->size )
+  {
+    hdr->first = SIZE_MAX;
+    hdr->last = 0;
+    return;
+  }
+
+  if( i == hdr->first )
+    hdr->first = cc_map_occupied_from( cntr, i + 1, el_size, layout );
+
+  if( i == hdr->last )
+    hdr->last = cc_map_occupied_before( cntr, i, el_size, layout );
+}
+
+// Places an element and its key in bucket i, which is either empty or occupied by an element with a probe length
+// shorter than probelen, and then moves any displaced elements further along the probe sequence in Robin-Hood fashion.
+// hash_val is the hash of the key, which is only used if the key type has the CC_STORE_HASH flag.
+// frag is the element's metadata fragment byte, which is only used if the key type has the CC_METADATA flag.
+// If el is NULL, the newly placed element is left uninitialized, and its own bucket serves as the buffer for carrying
+// displaced elements.
+// Returns a pointer-iterator to the newly placed element.
+// For the exact mechanics of Robin-Hood hashing, see Sebastian Sylvan's helpful article:
+// www.sebastiansylvan.com/post/robin-hood-hashing-should-be-your-default-hash-table-implementation
+// This function exists separately from the searching loops of its callers because of an optimization not mentioned in
+// descriptions of Robin Hood hashing.
+// Specifically, a second loop is entered once the element to insert has found its bucket.
+// This allows us to eliminate some checks and branching based on whether the element to insert has already been placed,
+// albeit at the cost of longer code.
+static inline void *cc_map_place(
+  void *cntr,
+  size_t i,
+  cc_probelen_ty probelen,
+  size_t hash_val,
+  unsigned char frag,
+  void *el,
+  void *key,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  void *to_return = cc_map_el( cntr, i, el_size, layout );
+  ++cc_map_hdr( cntr )->size;
+
+  if( !el )
+    el = to_return;
+
+  while( true )
+  {
+    if( !*cc_map_probelen( cntr, i, el_size, layout ) )
+    {
+      memcpy( cc_map_key( cntr, i, el_size, layout ), key, CC_KEY_SIZE( layout ) );
+      if( el != cc_map_el( cntr, i, el_size, layout ) )
+        memcpy( cc_map_el( cntr, i, el_size, layout ), el, el_size );
+      *cc_map_probelen( cntr, i, el_size, layout ) = probelen;
+      cc_map_note_probelen( cntr, probelen );
+      cc_map_note_occupied( cntr, i, el_size, layout );
+
+      if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+        cc_map_hashes( cntr, el_size, layout )[ i ] = hash_val;
+
+      if( CC_HAS_FLAG( layout, CC_METADATA ) )
+        cc_map_set_meta( cntr, i, frag, el_size, layout );
+
+      return to_return;
+    }
+
+    if( probelen > *cc_map_probelen( cntr, i, el_size, layout ) )
+    {
+      CC_MEMSWAP( key, cc_map_key( cntr, i, el_size, layout ), CC_KEY_SIZE( layout ) );
+      if( el != cc_map_el( cntr, i, el_size, layout ) )
+        CC_MEMSWAP( el, cc_map_el( cntr, i, el_size, layout ), el_size );
+
+      cc_probelen_ty temp_probelen = *cc_map_probelen( cntr, i, el_size, layout );
+      *cc_map_probelen( cntr, i, el_size, layout ) = probelen;
+      cc_map_note_probelen( cntr, probelen );
+      probelen = temp_probelen;
+
+      if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+      {
+        size_t temp_hash_val = cc_map_hashes( cntr, el_size, layout )[ i ];
+        cc_map_hashes( cntr, el_size, layout )[ i ] = hash_val;
+        hash_val = temp_hash_val;
+      }
+
+      if( CC_HAS_FLAG( layout, CC_METADATA ) )
+      {
+        unsigned char temp_frag = cc_map_metadata( cntr, el_size, layout )[ i ];
+        cc_map_set_meta( cntr, i, frag, el_size, layout );
+        frag = temp_frag;
+      }
+    }
+
+    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
+    ++probelen;
+  }
+}
+
+// Inserts an element whose key is known not to already exist in the map.
+// Assumes that the map has empty slots and therefore that failure cannot occur (hence the "raw" label).
+// This function is used for rehashing when the map's capacity changes, as well as for inserting keys that a metadata
+// lookup has already failed to find.
+// When we known that the key is new, we can skip certain checks and achieve a small performance improvement.
+static inline void *cc_map_insert_raw_unique(
+  void *cntr,
+  void *el,
+  void *key,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  size_t i = hash_val & ( cc_map_hdr( cntr )->cap - 1 );
+  cc_probelen_ty probelen = 1;
+
+  while( probelen <= *cc_map_probelen( cntr, i, el_size, layout ) )
+  {
+    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
+    ++probelen;
+  }
+
+  // Empty bucket, or stealing occupied bucket.
+  return cc_map_place( cntr, i, probelen, hash_val, cc_map_meta_frag( hash_val ), el, key, el_size, layout );
+}
+
+// Handles the insertion of an element whose key already exists in bucket i.
+// If replace is true, then el and key replace the existing element and key.
+// If el is also NULL, the existing element is destroyed and left uninitialized.
+// Returns a pointer-iterator to the element in bucket i.
+static inline void *cc_map_insert_existing(
+  void *cntr,
+  size_t i,
+  void *el,
+  void *key,
+  bool replace,
+  size_t el_size,
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor
+)
+{
+  if( replace )
+  {
+    if( key_dtor )
+      key_dtor( cc_map_key( cntr, i, el_size, layout ) );
+
+    if( el_dtor )
+      el_dtor( cc_map_el( cntr, i, el_size, layout ) );
+
+    memcpy( cc_map_key( cntr, i, el_size, layout ), key, CC_KEY_SIZE( layout ) );
+    if( el )
+      memcpy( cc_map_el( cntr, i, el_size, layout ), el, el_size );
+  }
+
+  return cc_map_el( cntr, i, el_size, layout );
+}
+
+// Inserts an element, whose key has the hash hash_val, into the map.
+// Assumes that the map has empty slots and therefore that failure cannot occur (hence the "raw" label).
+// If replace is true, then el will replace any existing element with the same key.
+// Returns a pointer-iterator to the newly inserted element, or to the existing element with the same key if replace is
+// false.
+static inline CC_ALWAYS_INLINE void *cc_map_insert_raw(
+  void *cntr,
+  void *el,
+  void *key,
+  bool replace,
+  size_t el_size,
+  uint64_t layout,
+  size_t hash_val,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor
+)
+{
+  // If the key type has the CC_METADATA flag, then we search for the key via the metadata array, which only requires
+  // full key comparisons for fragment matches, and then insert the element as unique if the key was not found.
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+  {
+    size_t i = cc_map_meta_find( cntr, key, hash_val, el_size, layout, cmpr );
+    if( i == cc_map_hdr( cntr )->cap )
+      return cc_map_insert_raw_unique( cntr, el, key, hash_val, el_size, layout );
+
+    return cc_map_insert_existing( cntr, i, el, key, replace, el_size, layout, el_dtor, key_dtor );
+  }
+
+  size_t i = hash_val & ( cc_map_hdr( cntr )->cap - 1 );
+  cc_probelen_ty probelen = 1;
+
+  while( true )
+  {
+    if( probelen > *cc_map_probelen( cntr, i, el_size, layout ) )
+      // Empty bucket, or stealing occupied bucket.
+      return cc_map_place( cntr, i, probelen, hash_val, 0 /* Dummy */, el, key, el_size, layout );
+
+    if(
+      probelen == *cc_map_probelen( cntr, i, el_size, layout ) &&
+      cc_map_hash_matches( cntr, i, hash_val, el_size, layout ) &&
+      cmpr( cc_map_key( cntr, i, el_size, layout ), key ) == 0
+    )
+      // Same key.
+      return cc_map_insert_existing( cntr, i, el, key, replace, el_size, layout, el_dtor, key_dtor );
+
+    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
+    ++probelen;
+  }
+}
+
+// Returns the index of the bucket containing the specified key, or the capacity if no such bucket exists.
+static inline CC_ALWAYS_INLINE size_t cc_map_find(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    return cc_map_meta_find( cntr, key, hash_val, el_size, layout, cmpr );
+
+  size_t i = hash_val & ( cc_map_hdr( cntr )->cap - 1 );
+  cc_probelen_ty probelen = 1;
+
+  while( probelen <= *cc_map_probelen( cntr, i, el_size, layout ) )
+  {
+    if(
+      probelen == *cc_map_probelen( cntr, i, el_size, layout ) &&
+      cc_map_hash_matches( cntr, i, hash_val, el_size, layout ) &&
+      cmpr( cc_map_key( cntr, i, el_size, layout ), key ) == 0
+    )
+      return i;
+
+    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
+    ++probelen;
+  }
+
+  return cc_map_hdr( cntr )->cap;
+}
+
+// Returns the minimum capacity required to accommodate n elements, which is governed by the max load factor associated
+// with the map's key type.
+static inline size_t cc_map_min_cap_for_n_els( size_t n, double max_load )
+{
+  if( n == 0 )
+    return 0;
+
+  // Round up to power of 2.
+  size_t cap = 8;
+  while( n > cap * max_load )
+    cap *= 2;
+
+  return cap;
+}
+
+// Allocates and initializes an empty map with capacity cap.
+// Returns pointer to the new map, or NULL in the case of allocation failure.
+static inline void *cc_map_make_empty(
+  size_t cap,
+  size_t el_size,
+  uint64_t layout,
+  cc_realloc_fnptr_ty realloc_
+)
+{
+  cc_map_hdr_ty *new_cntr = (cc_map_hdr_ty *)realloc_( NULL, cc_map_alloc_size( cap, el_size, layout ) );
+  if( !new_cntr )
+    return NULL;
+
+  new_cntr->size = 0;
+  new_cntr->cap = cap;
+  new_cntr->max_probelen = 0;
+  new_cntr->old = NULL;
+  new_cntr->migration_start = 0;
+  new_cntr->migrated = 0;
+  for( size_t i = 0; i < cap; ++i )
+    *cc_map_probelen( new_cntr, i, el_size, layout ) = 0;
+
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    memset( cc_map_metadata( new_cntr, el_size, layout ), 0, cap + CC_META_GROUP_SIZE );
+
+  cc_map_reset_occupancy( new_cntr, el_size, layout );
+
+  return new_cntr;
+}
+
+// Returns the hash of the key in bucket i, either from the stored hashes or by calling the hash function.
+static inline size_t cc_map_bucket_hash(
+  void *cntr,
+  size_t i,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash
+)
+{
+  if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+    return cc_map_hashes( cntr, el_size, layout )[ i ];
+
+  return hash( cc_map_key( cntr, i, el_size, layout ) );
+}
+
+// Incremental rehashing.
+// If the CC_INCREMENTAL flag is set for the key type, growth triggered by an insertion does not move all elements at
+// once.
+// Instead, the header of the new table keeps a pointer to the old table, and each subsequent insertion or erasure (by
+// key) migrates CC_MAP_MIGRATION_STEP buckets from the old table to the new one.
+// Until the migration is complete, lookups consult both tables.
+// Buckets are migrated in order, beginning with a bucket that starts a cluster (i.e. an empty bucket or an element in
+// its home bucket).
+// Hence, no probe sequence belonging to an element remaining in the old table can begin before the run of migrated
+// buckets and continue through it, so a lookup whose home bucket has already been migrated can simply resume probing at
+// the first unmigrated bucket.
+// The old table is only ever erased from, so this property holds until the migration is complete.
+// Lookups in the old table do not use its metadata array (if any) because they may need to begin mid-cluster.
+// Operations that traverse the whole map (e.g. iteration) visit the elements in the old table first.
+// get never migrates buckets, so that it does not invalidate pointer-iterators.
+#define CC_MAP_MIGRATION_STEP 16
+
+static inline CC_ALWAYS_INLINE void *cc_map_old( void *cntr, uint64_t layout )
+{
+  return CC_HAS_FLAG( layout, CC_INCREMENTAL ) ? cc_map_hdr( cntr )->old : NULL;
+}
+
+// Returns the index of the bucket in the old table containing the specified key, or the old table's capacity if no such
+// bucket exists.
+// Assumes that the map has an old table.
+static inline CC_ALWAYS_INLINE size_t cc_map_old_find(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  cc_map_hdr_ty *hdr = cc_map_hdr( cntr );
+  void *old = hdr->old;
+  size_t mask = cc_map_hdr( old )->cap - 1;
+  size_t i = hash_val & mask;
+  cc_probelen_ty probelen = 1;
+
+  // If the home bucket has already been migrated, skip to the first unmigrated bucket.
+  size_t dist_from_start = ( i - hdr->migration_start ) & mask;
+  if( dist_from_start < hdr->migrated )
+  {
+    // If the skip takes the probe beyond the longest probe length in the old table, the key cannot be there.
+    // Checking this first also ensures that the probe length cannot overflow.
+    if( hdr->migrated - dist_from_start >= cc_map_hdr( old )->max_probelen )
+      return mask + 1;
+
+    probelen += (cc_probelen_ty)( hdr->migrated - dist_from_start );
+    i = ( hdr->migration_start + hdr->migrated ) & mask;
+  }
+
+  while( probelen <= *cc_map_probelen( old, i, el_size, layout ) )
+  {
+    if(
+      probelen == *cc_map_probelen( old, i, el_size, layout ) &&
+      cc_map_hash_matches( old, i, hash_val, el_size, layout ) &&
+      cmpr( cc_map_key( old, i, el_size, layout ), key ) == 0
+    )
+      return i;
+
+    i = ( i + 1 ) & mask;
+    ++probelen;
+  }
+
+  return mask + 1;
+}
+
+// Migrates up to n buckets from the old table to the new one and frees the old table once all its buckets have been
+// migrated.
+// Assumes that the map has an old table.
+static inline void cc_map_migrate(
+  void *cntr,
+  size_t n,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_free_fnptr_ty free_
+)
+{
+  cc_map_hdr_ty *hdr = cc_map_hdr( cntr );
+  void *old = hdr->old;
+  size_t old_cap = cc_map_hdr( old )->cap;
+
+  for( ; n > 0 && hdr->migrated < old_cap; --n, ++hdr->migrated )
+  {
+    size_t i = ( hdr->migration_start + hdr->migrated ) & ( old_cap - 1 );
+    if( !*cc_map_probelen( old, i, el_size, layout ) )
+      continue;
+
+#ifdef CC_SMALL_PROBELEN
+    // The remaining buckets stay in the old table until the next insertion forces a complete rehash.
+    if( hdr->max_probelen >= CC_MAP_PROBELEN_LIMIT )
+      break;
+#endif
+
+    cc_map_insert_raw_unique(
+      cntr,
+      cc_map_el( old, i, el_size, layout ),
+      cc_map_key( old, i, el_size, layout ),
+      cc_map_bucket_hash( old, i, el_size, layout, hash ),
+      el_size,
+      layout
+    );
+
+    *cc_map_probelen( old, i, el_size, layout ) = 0;
+    --cc_map_hdr( old )->size;
+    cc_map_note_vacated( old, i, el_size, layout );
+  }
+
+  if( hdr->migrated == old_cap )
+  {
+    free_( old );
+    hdr->old = NULL;
+  }
+}
+
+// Creates a new, empty table with capacity cap and makes cntr its old table, to be migrated incrementally.
+// Assumes that cntr is not a placeholder and does not itself have an old table.
+// Returns pointer to the new table, or NULL in the case of allocation failure.
+static inline void *cc_map_begin_incremental_rehash(
+  void *cntr,
+  size_t cap,
+  size_t el_size,
+  uint64_t layout,
+  cc_realloc_fnptr_ty realloc_
+)
+{
+  cc_map_hdr_ty *new_cntr = (cc_map_hdr_ty *)cc_map_make_empty( cap, el_size, layout, realloc_ );
+  if( !new_cntr )
+    return NULL;
+
+  // Find a bucket that starts a cluster.
+  // Since the max load factor is below 1.0, an empty bucket must exist.
+  size_t start = 0;
+  while( *cc_map_probelen( cntr, start, el_size, layout ) > 1 )
+    ++start;
+
+  new_cntr->old = cntr;
+  new_cntr->migration_start = start;
+  new_cntr->migrated = 0;
+
+  return new_cntr;
+}
+
+// Returns the table (i.e. cntr or its old table) containing the element pointed to by pointer-iterator itr.
+static inline void *cc_map_itr_table( void *cntr, void *itr, size_t el_size, uint64_t layout )
+{
+  void *old = cc_map_old( cntr, layout );
+  if(
+    old &&
+    (char *)itr >= (char *)cc_map_el( old, 0, el_size, layout ) &&
+    (char *)itr < (char *)cc_map_el( old, cc_map_hdr( old )->cap, el_size, layout )
+  )
+    return old;
+
+  return cntr;
+}
+
+// Frees the map, along with its old table if it has one, unless it is a placeholder.
+static inline void cc_map_free( void *cntr, uint64_t layout, cc_free_fnptr_ty free_ )
+{
+  if( cc_map_is_placeholder( cntr ) )
+    return;
+
+  if( cc_map_old( cntr, layout ) )
+    free_( cc_map_old( cntr, layout ) );
+
+  free_( cntr );
+}
+
+// Creates a rehashed duplicate of cntr with capacity cap.
+// Assumes that cap is large enough to accommodate all elements in cntr without violating the max load factor.
+// If cntr has an old table, its elements are also moved into the duplicate.
+// Returns pointer to the duplicate, or NULL in the case of allocation failure or, if CC_SMALL_PROBELEN is defined, if
+// the duplicate's probe lengths would exceed CC_MAP_PROBELEN_LIMIT.
+static inline void *cc_map_make_rehash(
+  void *cntr,
+  size_t cap,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  void *new_cntr = cc_map_make_empty( cap, el_size, layout, realloc_ );
+  if( !new_cntr )
+    return NULL;
+
+  void *tables[ 2 ] = { cc_map_old( cntr, layout ), cntr };
+  for( int t = 0; t < 2; ++t )
+  {
+    if( !tables[ t ] )
+      continue;
+
+    for( size_t i = 0; i < cc_map_hdr( tables[ t ] )->cap; ++i )
+      if( *cc_map_probelen( tables[ t ], i, el_size, layout ) )
+      {
+#ifdef CC_SMALL_PROBELEN
+        if( cc_map_hdr( new_cntr )->max_probelen >= CC_MAP_PROBELEN_LIMIT )
+        {
+          free_( new_cntr );
+          return NULL;
+        }
+#endif
+
+        cc_map_insert_raw_unique(
+          new_cntr,
+          cc_map_el( tables[ t ], i, el_size, layout ),
+          cc_map_key( tables[ t ], i, el_size, layout ),
+          cc_map_bucket_hash( tables[ t ], i, el_size, layout, hash ),
+          el_size,
+          layout
+        );
+      }
+  }
+
+#ifndef CC_SMALL_PROBELEN
+  (void)free_;
+#endif
+
+  return new_cntr;
+}
+
+#ifdef CC_SMALL_PROBELEN
+
+// Rehashes the map into a new table with double its current capacity, or more if necessary, so that its max_probelen
+// falls below CC_MAP_PROBELEN_LIMIT.
+// This function is called when an insertion finds the map at the limit.
+// Returns a pointer to the new table, or NULL if the limit could not be respected within CC_MAP_MAX_FORCED_GROWTHS
+// doublings or an allocation failed, in which case the map is unchanged.
+static inline void *cc_map_make_rehash_within_probelen_limit(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t cap = cc_map_cap( cntr );
+  for( int i = 0; i < CC_MAP_MAX_FORCED_GROWTHS; ++i )
+  {
+    cap *= 2;
+    void *new_cntr = cc_map_make_rehash( cntr, cap, el_size, layout, hash, realloc_, free_ );
+    if( new_cntr )
+    {
+      if( cc_map_hdr( new_cntr )->max_probelen < CC_MAP_PROBELEN_LIMIT )
+        return new_cntr;
+
+      free_( new_cntr );
+    }
+  }
+
+  return NULL;
+}
+
+#endif
+
+// Completes the incremental migration in progress.
+// If CC_SMALL_PROBELEN is defined, the migration may stop short (see cc_map_migrate), in which case the elements of both
+// tables are rehashed into a larger table.
+// Assumes that the map has an old table.
+// Returns a pointer to the map, which may have moved, or NULL in the case of allocation failure, in which case the
+// migration remains in progress.
+static inline void *cc_map_finish_migration(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  cc_map_migrate( cntr, SIZE_MAX, el_size, layout, hash, free_ );
+
+#ifdef CC_SMALL_PROBELEN
+  if( cc_map_old( cntr, layout ) )
+  {
+    void *new_cntr = cc_map_make_rehash_within_probelen_limit( cntr, el_size, layout, hash, realloc_, free_ );
+    if( !new_cntr )
+      return NULL;
+
+    cc_map_free( cntr, layout, free_ );
+    return new_cntr;
+  }
+#else
+  (void)realloc_;
+#endif
+
+  return cntr;
+}
+
+// Grows the map to capacity cap by reallocating its memory and redistributing its elements in place, which avoids
+// keeping the old and new bucket arrays alive at the same time.
+// Because capacities are powers of two, each element's new home bucket is its old home bucket plus a multiple of the
+// old capacity.
+// Hence, if elements are reinserted in bucket order, any reinsertion only probes buckets that have already been
+// processed or that lie in the new, initially empty, part of the array, and it can go no further than the bucket that
+// the element was taken from.
+// The only exception is the tail of a cluster that wraps around from the end of the old array to its beginning.
+// The elements in that tail are set aside in a small temporary buffer, which also provides a scratch bucket, and are
+// reinserted last.
+// Assumes that the map is not a placeholder, that it has no old table, and that its key type does not have the CC_SOA
+// flag.
+// Returns a pointer to the grown map, or NULL in the case of allocation failure, in which case the map is unchanged.
+static inline void *cc_map_grow_in_place(
+  void *cntr,
+  size_t cap,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t old_cap = cc_map_hdr( cntr )->cap;
+  size_t bucket_size = CC_BUCKET_SIZE( el_size, layout );
+
+  // An element belongs to a wrapped tail if its probe length shows that its home bucket lies before the beginning of
+  // the array.
+  size_t n_wrapped = 0;
+  while( *cc_map_probelen( cntr, n_wrapped, el_size, layout ) > n_wrapped + 1 )
+    ++n_wrapped;
+
+  size_t temp_hashes_size = sizeof( size_t ) * n_wrapped;
+  temp_hashes_size += CC_PADDING( temp_hashes_size, alignof( max_align_t ) );
+
+  char *temp = (char *)realloc_( NULL, temp_hashes_size + bucket_size * ( n_wrapped + 1 ) );
+  if( !temp )
+    return NULL;
+
+  size_t *temp_hashes = (size_t *)temp;
+  char *temp_buckets = temp + temp_hashes_size;
+  char *scratch = temp_buckets + bucket_size * n_wrapped;
+
+  cc_map_hdr_ty *new_cntr = (cc_map_hdr_ty *)realloc_( cntr, cc_map_alloc_size( cap, el_size, layout ) );
+  if( !new_cntr )
+  {
+    free_( temp );
+    return NULL;
+  }
+
+  // Move the stored hashes, if any, to their new position after the enlarged bucket array.
+  if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+    memmove(
+      (char *)new_cntr + sizeof( cc_map_hdr_ty ) + bucket_size * cap,
+      (char *)new_cntr + sizeof( cc_map_hdr_ty ) + bucket_size * old_cap,
+      sizeof( size_t ) * old_cap
+    );
+
+  new_cntr->cap = cap;
+  new_cntr->size = 0;
+  new_cntr->max_probelen = 0;
+
+  for( size_t i = 0; i < n_wrapped; ++i )
+  {
+    temp_hashes[ i ] = cc_map_bucket_hash( new_cntr, i, el_size, layout, hash );
+    memcpy( temp_buckets + bucket_size * i, cc_map_el( new_cntr, i, el_size, layout ), bucket_size );
+    *cc_map_probelen( new_cntr, i, el_size, layout ) = 0;
+  }
+
+  for( size_t i = old_cap; i < cap; ++i )
+    *cc_map_probelen( new_cntr, i, el_size, layout ) = 0;
+
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    memset( cc_map_metadata( new_cntr, el_size, layout ), 0, cap + CC_META_GROUP_SIZE );
+
+  cc_map_reset_occupancy( new_cntr, el_size, layout );
+
+  for( size_t i = n_wrapped; i < old_cap; ++i )
+    if( *cc_map_probelen( new_cntr, i, el_size, layout ) )
+    {
+      size_t hash_val = cc_map_bucket_hash( new_cntr, i, el_size, layout, hash );
+      memcpy( scratch, cc_map_el( new_cntr, i, el_size, layout ), bucket_size );
+      *cc_map_probelen( new_cntr, i, el_size, layout ) = 0;
+
+      cc_map_insert_raw_unique(
+        new_cntr,
+        scratch,
+        scratch + CC_KEY_OFFSET( el_size, layout ),
+        hash_val,
+        el_size,
+        layout
+      );
+    }
+
+  for( size_t i = 0; i < n_wrapped; ++i )
+    cc_map_insert_raw_unique(
+      new_cntr,
+      temp_buckets + bucket_size * i,
+      temp_buckets + bucket_size * i + CC_KEY_OFFSET( el_size, layout ),
+      temp_hashes[ i ],
+      el_size,
+      layout
+    );
+
+  free_( temp );
+  return new_cntr;
+}
+
+// Grows the map to capacity cap, which must exceed its current capacity.
+// Where possible, the existing memory is grown and the elements are redistributed in place rather than copied into a
+// new allocation.
+// Returns a cc_allocing_fn_result_ty containing new container handle and a pointer that evaluates to true if the
+// operation successful or false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_map_grow(
+  void *cntr,
+  size_t cap,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( !cc_map_is_placeholder( cntr ) && !CC_HAS_FLAG( layout, CC_SOA ) && !cc_map_old( cntr, layout ) )
+  {
+    void *new_cntr = cc_map_grow_in_place( cntr, cap, el_size, layout, hash, realloc_, free_ );
+    if( !new_cntr )
+      return cc_make_allocing_fn_result( cntr, NULL );
+
+    return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+  }
+
+  void *new_cntr = cc_map_make_rehash(
+    cntr,
+    cap,
+    el_size,
+    layout,
+    hash,
+    realloc_,
+    free_
+  );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  cc_map_free( cntr, layout, free_ );
+
+  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+}
+
+// Reserves capacity such that the map can accommodate n elements without reallocation (i.e. without violating the
+// max load factor).
+// Returns a cc_allocing_fn_result_ty containing new container handle and a pointer that evaluates to true if the
+// operation successful or false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_map_reserve(
+  void *cntr,
+  size_t n,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  double max_load,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t cap = cc_map_min_cap_for_n_els( n, max_load );
+
+  if( cc_map_cap( cntr ) >= cap )
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  return cc_map_grow( cntr, cap, el_size, layout, hash, realloc_, free_ );
+}
+
+// Returns the capacity to which the map must grow before an element is inserted, or zero if no growth is necessary.
+// The map must grow if the insertion would violate the max load factor or if, since the map was last rehashed, an
+// element has been placed further from its home bucket than the max probe length allows.
+// In the latter case, the map only grows if its size is at least a quarter of its capacity multiplied by the max load
+// factor, which bounds the growth that keys that collide regardless of the capacity can cause.
+static inline CC_ALWAYS_INLINE size_t cc_map_growth_cap( void *cntr, double max_load, size_t max_probelen )
+{
+  size_t size = cc_map_size( cntr ) + 1;
+  size_t cap = cc_map_cap( cntr );
+
+  if( size > cap * max_load )
+    return cc_map_min_cap_for_n_els( size, max_load );
+
+  if( cc_map_hdr( cntr )->max_probelen > max_probelen && size * 4 > cap * max_load )
+    return cap * 2;
+
+  return 0;
+}
+
+// Inserts an element whose key has the hash hash_val.
+// If replace is true, then el replaces any existing element with the same key.
+// If el is NULL, the inserted or replacing element is left uninitialized for the caller to construct in place.
+// If the map exceeds its load factor or its key type's max probe length (see cc_map_growth_cap), the underlying storage
+// is expanded and a complete rehash occurs, unless the key type has the CC_INCREMENTAL flag, in which case the elements
+// are migrated to the new storage over subsequent insertions and erasures.
+// If CC_SMALL_PROBELEN is defined and the map's max_probelen has reached CC_MAP_PROBELEN_LIMIT, a complete rehash into
+// a larger table is forced so that the insertion cannot create a probe length beyond the limit.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer to the newly inserted element,
+// or to the existing element with the same key if replace is false.
+// If the underlying storage needed to be expanded and an allocation failure occurred, the latter pointer will be NULL.
+// This function checks to ensure that the map could accommodate an insertion before searching for the existing element.
+// Therefore, failure can occur even if an element with the same key already exists and no reallocation was actually
+// necessary.
+// This was a design choice in favor of code simplicity and readability over ideal behavior in a corner case.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_map_insert_hashed(
+  void *cntr,
+  void *el,
+  void *key,
+  size_t hash_val,
+  bool replace,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_map_old( cntr, layout ) )
+    cc_map_migrate( cntr, CC_MAP_MIGRATION_STEP, el_size, layout, hash, free_ );
+
+  size_t growth_cap = cc_map_growth_cap( cntr, max_load, max_probelen );
+  if( growth_cap )
+  {
+    if( CC_HAS_FLAG( layout, CC_INCREMENTAL ) && !cc_map_is_placeholder( cntr ) )
+    {
+      // A previous migration can only still be in progress if the max load factor is very low or the map grew because
+      // of its max probe length.
+      // Completing it may rehash the map into a larger table, so the need for growth is then reassessed.
+      if( cc_map_old( cntr, layout ) )
+      {
+        void *new_cntr = cc_map_finish_migration( cntr, el_size, layout, hash, realloc_, free_ );
+        if( !new_cntr )
+          return cc_make_allocing_fn_result( cntr, NULL );
+
+        cntr = new_cntr;
+        growth_cap = cc_map_growth_cap( cntr, max_load, max_probelen );
+      }
+
+      if( growth_cap )
+      {
+        void *new_cntr = cc_map_begin_incremental_rehash( cntr, growth_cap, el_size, layout, realloc_ );
+        if( !new_cntr )
+          return cc_make_allocing_fn_result( cntr, NULL );
+
+        cntr = new_cntr;
+      }
+    }
+    else
+    {
+      cc_allocing_fn_result_ty result = cc_map_grow(
+        cntr,
+        growth_cap,
+        el_size,
+        layout,
+        hash,
+        realloc_,
+        free_
+      );
+
+      if( !result.other_ptr )
+        return result;
+
+      cntr = result.new_cntr;
+    }
+  }
+
+#ifdef CC_SMALL_PROBELEN
+  if( cc_map_hdr( cntr )->max_probelen >= CC_MAP_PROBELEN_LIMIT )
+  {
+    void *new_cntr = cc_map_make_rehash_within_probelen_limit( cntr, el_size, layout, hash, realloc_, free_ );
+    if( !new_cntr )
+      return cc_make_allocing_fn_result( cntr, NULL );
+
+    cc_map_free( cntr, layout, free_ );
+    cntr = new_cntr;
+  }
+#endif
+
+  // A key that has not yet been migrated is updated in the old table.
+  if( cc_map_old( cntr, layout ) )
+  {
+    void *old = cc_map_hdr( cntr )->old;
+    size_t i = cc_map_old_find( cntr, key, hash_val, el_size, layout, cmpr );
+    if( i != cc_map_hdr( old )->cap )
+      return cc_make_allocing_fn_result(
+        cntr,
+        cc_map_insert_existing( old, i, el, key, replace, el_size, layout, el_dtor, key_dtor )
+      );
+  }
+
+  void *new_el = cc_map_insert_raw(
+    cntr,
+    el,
+    key,
+    replace,
+    el_size,
+    layout,
+    hash_val,
+    cmpr,
+    el_dtor,
+    key_dtor
+  );
+
+  return cc_make_allocing_fn_result( cntr, new_el );
+}
+
+// Inserts an element.
+// This function is a wrapper around cc_map_insert_hashed that computes the key's hash.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_map_insert(
+  void *cntr,
+  void *el,
+  void *key,
+  bool replace,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_insert_hashed(
+    cntr,
+    el,
+    key,
+    hash( key ),
+    replace,
+    el_size,
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    el_dtor,
+    key_dtor,
+    realloc_,
+    free_
+  );
+}
+
+// Inserts an uninitialized element for the caller to construct in place if no element with the specified key exists.
+// *inserted is set to whether the element was inserted, which is determined by comparing the map's size before
+// and after the insertion.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer-iterator to the new or existing
+// element, or NULL in the case of memory allocation failure.
+static inline cc_allocing_fn_result_ty cc_map_get_or_insert_uninit(
+  void *cntr,
+  void *key,
+  bool *inserted,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t size = cc_map_size( cntr );
+
+  cc_allocing_fn_result_ty result = cc_map_insert(
+    cntr,
+    NULL,
+    key,
+    false,
+    el_size,
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    NULL, // Dummy.
+    el_dtor,
+    key_dtor,
+    realloc_,
+    free_
+  );
+
+  *inserted = result.other_ptr && cc_map_size( result.new_cntr ) != size;
+  return result;
+}
+
+// Returns a pointer-iterator to the element with the specified key, whose hash is hash_val, or NULL if no such element
+// exists.
+static inline CC_ALWAYS_INLINE void *cc_map_get_hashed(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  if( cc_map_size( cntr ) == 0 )
+    return NULL;
+
+  size_t i = cc_map_find( cntr, key, hash_val, el_size, layout, cmpr );
+  if( i != cc_map_hdr( cntr )->cap )
+    return cc_map_el( cntr, i, el_size, layout );
+
+  if( cc_map_old( cntr, layout ) )
+  {
+    void *old = cc_map_hdr( cntr )->old;
+    i = cc_map_old_find( cntr, key, hash_val, el_size, layout, cmpr );
+    if( i != cc_map_hdr( old )->cap )
+      return cc_map_el( old, i, el_size, layout );
+  }
+
+  return NULL;
+}
+
+// Returns a pointer-iterator to the element with the specified key, or NULL if no such element exists.
+static inline CC_ALWAYS_INLINE void *cc_map_get(
+  void *cntr,
+  void *key,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  if( cc_map_size( cntr ) == 0 )
+    return NULL;
+
+  return cc_map_get_hashed( cntr, key, hash( key ), el_size, layout, cmpr );
+}
+
+// Returns a pointer to the key for the element pointed to by the specified pointer-iterator.
+static inline void *cc_map_key_for(
+  void *cntr,
+  void *itr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+  {
+    cntr = cc_map_itr_table( cntr, itr, el_size, layout );
+    return cc_map_key( cntr, cc_map_itr_index( cntr, itr, el_size, layout ), el_size, layout );
+  }
+
+  return (char *)itr + CC_KEY_OFFSET( el_size, layout );
+}
+
+// Erases the element pointer to by pointer-iterator itr.
+// For the exact mechanics of erasing elements in a Robin-Hood hash table, see Sebastian Sylvan's:
+// www.sebastiansylvan.com/post/more-on-robin-hood-hashing-2/
+static inline void cc_map_erase_itr(
+  void *cntr,
+  void *itr,
+  size_t el_size,
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor
+)
+{
+  cntr = cc_map_itr_table( cntr, itr, el_size, layout );
+
+  size_t i = cc_map_itr_index( cntr, itr, el_size, layout );
+  *cc_map_probelen( cntr, i, el_size, layout ) = 0;
+  --cc_map_hdr( cntr )->size;
+
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    cc_map_set_meta( cntr, i, 0, el_size, layout );
+
+  if( key_dtor )
+    key_dtor( cc_map_key( cntr, i, el_size, layout ) );
+
+  if( el_dtor )
+    el_dtor( cc_map_el( cntr, i, el_size, layout ) );
+
+  // Only the last bucket in the backward shift below ends up empty.
+  while( true )
+  {
+    size_t next = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
+    if( *cc_map_probelen( cntr, next, el_size, layout ) <= 1 )
+    {
+      cc_map_note_vacated( cntr, i, el_size, layout );
+      break; // Empty slot or key already in its home bucket, so all done.
+    }
+    
+    //Bump backwards.
+
+    memcpy(
+      cc_map_key( cntr, i, el_size, layout ),
+      cc_map_key( cntr, next, el_size, layout ),
+      CC_KEY_SIZE( layout )
+    );
+    memcpy( cc_map_el( cntr, i, el_size, layout ), cc_map_el( cntr, next, el_size, layout ), el_size );
+
+    *cc_map_probelen( cntr, i, el_size, layout ) =
+      *cc_map_probelen( cntr, next, el_size, layout ) - 1;
+    *cc_map_probelen( cntr, next, el_size, layout ) = 0;
+
+    if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+      cc_map_hashes( cntr, el_size, layout )[ i ] = cc_map_hashes( cntr, el_size, layout )[ next ];
+
+    if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    {
+      cc_map_set_meta( cntr, i, cc_map_metadata( cntr, el_size, layout )[ next ], el_size, layout );
+      cc_map_set_meta( cntr, next, 0, el_size, layout );
+    }
+
+    i = next;
+  }
+}
+
+// Erases the element with the specified key, whose hash is hash_val, if it exists.
+// Returns a pointer that evaluates to true if an element was erased, or else is NULL.
+static inline CC_ALWAYS_INLINE void *cc_map_erase_hashed(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_map_size( cntr ) == 0 )
+    return NULL;
+
+  if( cc_map_old( cntr, layout ) )
+    cc_map_migrate( cntr, CC_MAP_MIGRATION_STEP, el_size, layout, hash, free_ );
+
+  size_t i = cc_map_find( cntr, key, hash_val, el_size, layout, cmpr );
+  if( i != cc_map_hdr( cntr )->cap )
+  {
+    cc_map_erase_itr( cntr, cc_map_el( cntr, i, el_size, layout ), el_size, layout, el_dtor, key_dtor );
+    return cc_dummy_true_ptr;
+  }
+
+  if( cc_map_old( cntr, layout ) )
+  {
+    void *old = cc_map_hdr( cntr )->old;
+    i = cc_map_old_find( cntr, key, hash_val, el_size, layout, cmpr );
+    if( i != cc_map_hdr( old )->cap )
+    {
+      cc_map_erase_itr( cntr, cc_map_el( old, i, el_size, layout ), el_size, layout, el_dtor, key_dtor );
+      return cc_dummy_true_ptr;
+    }
+  }
+
+  return NULL;
+}
+
+// Erases the element with the specified key, if it exists.
+// Returns a pointer that evaluates to true if an element was erased, or else is NULL.
+// This pointer is eventually cast to bool by the cc_erase API macro.
+static inline CC_ALWAYS_INLINE void *cc_map_erase(
+  void *cntr,
+  void *key,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_map_size( cntr ) == 0 )
+    return NULL;
+
+  return cc_map_erase_hashed( cntr, key, hash( key ), el_size, layout, hash, cmpr, el_dtor, key_dtor, free_ );
+}
+
+// Erases all elements of one table (i.e. a map or its old table) for which pred returns true, calling the destructors
+// for the key and element types if necessary.
+// pred is a cc_key_el_pred_fnptr_ty called with pointers to each element's key and the element itself or, in the case
+// of sets (whose element size is zero), a cc_pred_fnptr_ty called with a pointer to each element only.
+// Rather than erasing matching elements one by one, each of which would entail its own backward shift of subsequent
+// elements, we make a single pass over the buckets that moves each surviving element back into the earliest vacated
+// bucket that does not precede its home bucket.
+// The pass begins at a bucket that starts a cluster (see cc_map_begin_incremental_rehash).
+// Because the elements in each cluster are ordered by home bucket, the earliest vacated bucket is only ever needed by
+// the element currently being visited, and the result is the same layout that individual erasures would produce.
+// In a partially migrated old table, a run of elements may follow the migrated (empty) buckets containing their home
+// buckets, so an element's home bucket is never assumed to lie at or after the bucket where the pass began.
+// Returns the number of elements erased.
+static inline size_t cc_map_erase_if_in_table(
+  void *cntr,
+  cc_pred_fnptr_ty pred,
+  size_t el_size,
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor
+)
+{
+  size_t mask = cc_map_hdr( cntr )->cap - 1;
+  size_t start = 0;
+  while( *cc_map_probelen( cntr, start, el_size, layout ) > 1 )
+    ++start;
+
+  // Positions below are offsets from start, so that they compare correctly across the end of the bucket array.
+  size_t vacant = SIZE_MAX; // Earliest vacated bucket in the current cluster, or SIZE_MAX if there is none.
+  size_t erased = 0;
+
+  for( size_t pos = 0; pos <= mask; ++pos )
+  {
+    size_t i = ( start + pos ) & mask;
+    cc_probelen_ty probelen = *cc_map_probelen( cntr, i, el_size, layout );
+    if( !probelen )
+    {
+      vacant = SIZE_MAX;
+      continue;
+    }
+
+    void *key = cc_map_key( cntr, i, el_size, layout );
+    void *el = cc_map_el( cntr, i, el_size, layout );
+
+    if( el_size ? ( (cc_key_el_pred_fnptr_ty)(cc_generic_fnptr_ty)pred )( key, el ) : pred( key ) )
+    {
+      if( key_dtor )
+        key_dtor( key );
+
+      if( el_dtor )
+        el_dtor( el );
+
+      *cc_map_probelen( cntr, i, el_size, layout ) = 0;
+      --cc_map_hdr( cntr )->size;
+      ++erased;
+      cc_map_note_vacated( cntr, i, el_size, layout );
+
+      if( CC_HAS_FLAG( layout, CC_METADATA ) )
+        cc_map_set_meta( cntr, i, 0, el_size, layout );
+
+      if( vacant == SIZE_MAX )
+        vacant = pos;
+
+      continue;
+    }
+
+    if( vacant == SIZE_MAX )
+      continue;
+
+    if( probelen == 1 )
+    {
+      // Neither this element nor any later one in the cluster can use the vacated buckets.
+      vacant = SIZE_MAX;
+      continue;
+    }
+
+    // The element moves to the earliest vacated bucket if its home bucket does not follow that bucket, or else to its
+    // home bucket.
+    size_t dest_pos = pos - vacant <= (size_t)( probelen - 1 ) ? vacant : pos - ( probelen - 1 );
+    size_t dest = ( start + dest_pos ) & mask;
+
+    memcpy( cc_map_key( cntr, dest, el_size, layout ), key, CC_KEY_SIZE( layout ) );
+    memcpy( cc_map_el( cntr, dest, el_size, layout ), el, el_size );
+    *cc_map_probelen( cntr, dest, el_size, layout ) = (cc_probelen_ty)( probelen - ( pos - dest_pos ) );
+    *cc_map_probelen( cntr, i, el_size, layout ) = 0;
+    cc_map_note_occupied( cntr, dest, el_size, layout );
+    cc_map_note_vacated( cntr, i, el_size, layout );
+
+    if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+      cc_map_hashes( cntr, el_size, layout )[ dest ] = cc_map_hashes( cntr, el_size, layout )[ i ];
+
+    if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    {
+      cc_map_set_meta( cntr, dest, cc_map_metadata( cntr, el_size, layout )[ i ], el_size, layout );
+      cc_map_set_meta( cntr, i, 0, el_size, layout );
+    }
+
+    vacant = dest_pos + 1;
+  }
+
+  return erased;
+}
+
+// Erases all elements for which pred returns true (see cc_map_erase_if_in_table).
+// Any incremental migration still in progress is completed first.
+// If CC_SMALL_PROBELEN is defined, the migration may stop short (see cc_map_migrate), and because this function cannot
+// reallocate the map, the elements remaining in the old table are then filtered there instead.
+// Returns the number of elements erased.
+static inline size_t cc_map_erase_if(
+  void *cntr,
+  cc_pred_fnptr_ty pred,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_map_size( cntr ) == 0 ) // Also handles placeholder.
+    return 0;
+
+  if( cc_map_old( cntr, layout ) )
+    cc_map_migrate( cntr, SIZE_MAX, el_size, layout, hash, free_ );
+
+  size_t erased = cc_map_erase_if_in_table( cntr, pred, el_size, layout, el_dtor, key_dtor );
+
+  if( cc_map_old( cntr, layout ) )
+    erased += cc_map_erase_if_in_table( cc_map_hdr( cntr )->old, pred, el_size, layout, el_dtor, key_dtor );
+
+  return erased;
+}
+
+// Batched operations.
+// cc_map_get_n, cc_map_erase_keys, and cc_map_insert_keys process their keys in groups of CC_MAP_BATCH_SIZE.
+// Each group is hashed, and the home bucket of every key in it is prefetched, before any of its keys are resolved.
+// Hence, for tables too large for the cache, the memory accesses for different keys overlap instead of occurring one
+// after another.
+
+#define CC_MAP_BATCH_SIZE 16
+
+// Prefetches the home bucket of a key whose hash is hash_val, along with its stored hash and metadata (if present).
+static inline void cc_map_prefetch( void *cntr, size_t hash_val, size_t el_size, uint64_t layout )
+{
+#ifdef __GNUC__
+  size_t home = hash_val & ( cc_map_hdr( cntr )->cap - 1 );
+
+  __builtin_prefetch( cc_map_probelen( cntr, home, el_size, layout ) );
+
+  if( CC_HAS_FLAG( layout, CC_SOA ) )
+    __builtin_prefetch( cc_map_key( cntr, home, el_size, layout ) );
+
+  if( CC_HAS_FLAG( layout, CC_STORE_HASH ) )
+    __builtin_prefetch( cc_map_hashes( cntr, el_size, layout ) + home );
+
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    __builtin_prefetch( cc_map_metadata( cntr, el_size, layout ) + home );
+#else
+  (void)cntr;
+  (void)hash_val;
+  (void)el_size;
+  (void)layout;
+#endif
+}
+
+// Hashes the n (at most CC_MAP_BATCH_SIZE) keys beginning at keys, storing the hashes in hash_vals, and prefetches
+// their home buckets.
+static inline CC_ALWAYS_INLINE void cc_map_hash_and_prefetch(
+  void *cntr,
+  void *keys,
+  size_t n,
+  size_t *hash_vals,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash
+)
+{
+  for( size_t i = 0; i < n; ++i )
+    hash_vals[ i ] = hash( (char *)keys + CC_KEY_SIZE( layout ) * i );
+
+  for( size_t i = 0; i < n; ++i )
+    cc_map_prefetch( cntr, hash_vals[ i ], el_size, layout );
+}
+
+// Looks up the n keys in array keys and writes a pointer-iterator to each corresponding element, or NULL if no such
+// element exists, into array out.
+// Returns the number of keys found.
+static inline CC_ALWAYS_INLINE size_t cc_map_get_n(
+  void *cntr,
+  void *keys,
+  size_t n,
+  void *out,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  size_t hash_vals[ CC_MAP_BATCH_SIZE ];
+  size_t found = 0;
+
+  for( size_t i = 0; i < n; i += CC_MAP_BATCH_SIZE )
+  {
+    size_t batch_n = n - i < CC_MAP_BATCH_SIZE ? n - i : CC_MAP_BATCH_SIZE;
+    void *batch_keys = (char *)keys + CC_KEY_SIZE( layout ) * i;
+
+    if( cc_map_size( cntr ) == 0 )
+    {
+      for( size_t j = 0; j < batch_n; ++j )
+        ( (void **)out )[ i + j ] = NULL;
+
+      continue;
+    }
+
+    cc_map_hash_and_prefetch( cntr, batch_keys, batch_n, hash_vals, el_size, layout, hash );
+
+    for( size_t j = 0; j < batch_n; ++j )
+    {
+      void *el = cc_map_get_hashed(
+        cntr,
+        (char *)batch_keys + CC_KEY_SIZE( layout ) * j,
+        hash_vals[ j ],
+        el_size,
+        layout,
+        cmpr
+      );
+
+      ( (void **)out )[ i + j ] = el;
+      found += !!el;
+    }
+  }
+
+  return found;
+}
+
+// Erases the elements with the n keys in array keys, where they exist.
+// Returns the number of elements erased.
+static inline CC_ALWAYS_INLINE size_t cc_map_erase_keys(
+  void *cntr,
+  void *keys,
+  size_t n,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t hash_vals[ CC_MAP_BATCH_SIZE ];
+  size_t erased = 0;
+
+  for( size_t i = 0; i < n && cc_map_size( cntr ); i += CC_MAP_BATCH_SIZE )
+  {
+    size_t batch_n = n - i < CC_MAP_BATCH_SIZE ? n - i : CC_MAP_BATCH_SIZE;
+    void *batch_keys = (char *)keys + CC_KEY_SIZE( layout ) * i;
+
+    cc_map_hash_and_prefetch( cntr, batch_keys, batch_n, hash_vals, el_size, layout, hash );
+
+    for( size_t j = 0; j < batch_n; ++j )
+      erased += !!cc_map_erase_hashed(
+        cntr,
+        (char *)batch_keys + CC_KEY_SIZE( layout ) * j,
+        hash_vals[ j ],
+        el_size,
+        layout,
+        hash,
+        cmpr,
+        el_dtor,
+        key_dtor,
+        free_
+      );
+  }
+
+  return erased;
+}
+
+// Bulk insertion.
+// When many keys are inserted at once, cc_map_insert_keys first partitions them by the most significant
+// CC_MAP_BULK_PARTITION_BITS bits of their home buckets (i.e. one pass of a radix sort) and then places them partition
+// by partition.
+// Each partition corresponds to a contiguous region of the bucket array, so placement sweeps through the array from
+// beginning to end instead of landing at random positions, and each region stays in the cache while its keys are placed.
+// The partitioning is stable, so later duplicates of a key still replace earlier ones.
+// The partitioning costs two extra passes over the keys, a second call to the hash function for each key, and
+// temporary memory for a copy of each key and element.
+// Hence, it is only used when the number of keys is at least CC_MAP_BULK_MIN_N, below which the table is likely to fit
+// in the cache anyway.
+// Smaller batches are instead hashed and prefetched CC_MAP_BATCH_SIZE keys at a time.
+
+#define CC_MAP_BULK_PARTITION_BITS 10
+#define CC_MAP_BULK_MIN_N          65536
+
+// Copies the element at index i in array els and its key at index i in array keys into scratch, whose key begins at
+// offset scratch_key_offset, and inserts them, replacing any existing element with the same key.
+// Because insertion uses the element and key passed to it as scratch space while displacing other elements, copying
+// them first leaves els and keys unmodified.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_map_insert_key_copy(
+  void *cntr,
+  void *keys,
+  void *els,
+  size_t i,
+  size_t hash_val,
+  char *scratch,
+  size_t scratch_key_offset,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  // For sets, els is a dummy pointer and el_size is zero.
+  memcpy( scratch, (char *)els + el_size * i, el_size );
+  memcpy( scratch + scratch_key_offset, (char *)keys + CC_KEY_SIZE( layout ) * i, CC_KEY_SIZE( layout ) );
+
+  return cc_map_insert_hashed(
+    cntr,
+    scratch,
+    scratch + scratch_key_offset,
+    hash_val,
+    true,
+    el_size,
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    el_dtor,
+    key_dtor,
+    realloc_,
+    free_
+  );
+}
+
+// Inserts the n elements in array els with the corresponding keys in array keys, replacing any existing elements with
+// the same keys.
+// The capacity is first increased to accommodate all n elements, so at most one rehash occurs.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
+// operation was successful and false in the case of allocation failure.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_map_insert_keys(
+  void *cntr,
+  void *keys,
+  void *els,
+  size_t n,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( n == 0 )
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  // If the keys are to be partitioned, the temporary buffer holds the keys and elements in partitioned order, the
+  // partition offsets, and the partition of each key, followed by the scratch element and key.
+  bool partition = n >= CC_MAP_BULK_MIN_N;
+  size_t n_partitions = (size_t)1 << CC_MAP_BULK_PARTITION_BITS;
+  size_t part_els_offset = 0;
+  size_t offsets_offset = 0;
+  size_t partitions_offset = 0;
+  size_t arrays_size = 0;
+  if( partition )
+  {
+    part_els_offset = CC_KEY_SIZE( layout ) * n + CC_PADDING( CC_KEY_SIZE( layout ) * n, alignof( max_align_t ) );
+    offsets_offset = part_els_offset + el_size * n + CC_PADDING( el_size * n, alignof( max_align_t ) );
+    partitions_offset = offsets_offset + sizeof( size_t ) * n_partitions;
+    arrays_size = partitions_offset + sizeof( uint16_t ) * n;
+    arrays_size += CC_PADDING( arrays_size, alignof( max_align_t ) );
+  }
+
+  size_t scratch_key_offset = el_size + CC_PADDING( el_size, alignof( max_align_t ) );
+
+  char *temp = (char *)realloc_( NULL, arrays_size + scratch_key_offset + CC_KEY_SIZE( layout ) );
+  if( !temp )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  char *scratch = temp + arrays_size;
+
+  cc_allocing_fn_result_ty result = cc_map_reserve(
+    cntr,
+    cc_map_size( cntr ) + n,
+    el_size,
+    layout,
+    hash,
+    max_load,
+    realloc_,
+    free_
+  );
+  if( !result.other_ptr )
+  {
+    free_( temp );
+    return result;
+  }
+
+  cntr = result.new_cntr;
+
+  if( partition )
+  {
+    char *part_keys = temp;
+    char *part_els = temp + part_els_offset;
+    size_t *offsets = (size_t *)( temp + offsets_offset );
+    uint16_t *partitions = (uint16_t *)( temp + partitions_offset );
+    size_t mask = cc_map_hdr( cntr )->cap - 1;
+    unsigned int shift = cc_ctz( mask + 1 ) > CC_MAP_BULK_PARTITION_BITS ?
+      cc_ctz( mask + 1 ) - CC_MAP_BULK_PARTITION_BITS : 0;
+
+    memset( offsets, 0, sizeof( size_t ) * n_partitions );
+    for( size_t i = 0; i < n; ++i )
+    {
+      partitions[ i ] = (uint16_t)( ( hash( (char *)keys + CC_KEY_SIZE( layout ) * i ) & mask ) >> shift );
+      ++offsets[ partitions[ i ] ];
+    }
+
+    // Convert the partition sizes into offsets.
+    for( size_t p = 0, offset = 0; p < n_partitions; ++p )
+    {
+      size_t partition_size = offsets[ p ];
+      offsets[ p ] = offset;
+      offset += partition_size;
+    }
+
+    for( size_t i = 0; i < n; ++i )
+    {
+      size_t k = offsets[ partitions[ i ] ]++;
+      memcpy( part_keys + CC_KEY_SIZE( layout ) * k, (char *)keys + CC_KEY_SIZE( layout ) * i, CC_KEY_SIZE( layout ) );
+      memcpy( part_els + el_size * k, (char *)els + el_size * i, el_size );
+    }
+
+    for( size_t k = 0; k < n; ++k )
+    {
+      result = cc_map_insert_key_copy(
+        cntr,
+        part_keys,
+        part_els,
+        k,
+        hash( part_keys + CC_KEY_SIZE( layout ) * k ),
+        scratch,
+        scratch_key_offset,
+        el_size,
+        layout,
+        hash,
+        cmpr,
+        max_load,
+        max_probelen,
+        el_dtor,
+        key_dtor,
+        realloc_,
+        free_
+      );
+      if( !result.other_ptr )
+      {
+        free_( temp );
+        return result;
+      }
+
+      cntr = result.new_cntr;
+    }
+  }
+  else
+  {
+    size_t hash_vals[ CC_MAP_BATCH_SIZE ];
+
+    for( size_t i = 0; i < n; i += CC_MAP_BATCH_SIZE )
+    {
+      size_t batch_n = n - i < CC_MAP_BATCH_SIZE ? n - i : CC_MAP_BATCH_SIZE;
+
+      cc_map_hash_and_prefetch(
+        cntr,
+        (char *)keys + CC_KEY_SIZE( layout ) * i,
+        batch_n,
+        hash_vals,
+        el_size,
+        layout,
+        hash
+      );
+
+      for( size_t j = 0; j < batch_n; ++j )
+      {
+        result = cc_map_insert_key_copy(
+          cntr,
+          keys,
+          els,
+          i + j,
+          hash_vals[ j ],
+          scratch,
+          scratch_key_offset,
+          el_size,
+          layout,
+          hash,
+          cmpr,
+          max_load,
+          max_probelen,
+          el_dtor,
+          key_dtor,
+          realloc_,
+          free_
+        );
+        if( !result.other_ptr )
+        {
+          free_( temp );
+          return result;
+        }
+
+        cntr = result.new_cntr;
+      }
+    }
+  }
+
+  free_( temp );
+  return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+}
+
+// Shrinks map's capacity to the minimum possible without violating the max load factor associated with the key type.
+// If shrinking is necessary, then a complete rehash occurs.
+// Any incremental migration still in progress is completed.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
+// operation was successful and false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_map_shrink(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  double max_load,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  size_t cap = cc_map_min_cap_for_n_els( cc_map_size( cntr ), max_load );
+
+  if( cap == cc_map_cap( cntr ) ) // Shrink unnecessary.
+  {
+    if( cc_map_old( cntr, layout ) )
+    {
+      void *new_cntr = cc_map_finish_migration( cntr, el_size, layout, hash, realloc_, free_ );
+      if( !new_cntr )
+        return cc_make_allocing_fn_result( cntr, NULL );
+
+      cntr = new_cntr;
+    }
+
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+  }
+
+  if( cap == 0 ) // Restore placeholder.
+  {
+    cc_map_free( cntr, layout, free_ );
+    return cc_make_allocing_fn_result( (void *)&cc_map_placeholder, cc_dummy_true_ptr );
+  }
+
+  void *new_cntr = cc_map_make_rehash(
+    cntr,
+    cap,
+    el_size,
+    layout,
+    hash,
+    realloc_,
+    free_
+  );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  cc_map_free( cntr, layout, free_ );
+
+  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+}
+
+// Auto-shrink function for maps (see cc_no_auto_shrink).
+// If the map's size has fallen below its capacity multiplied by min_load, capped at a quarter of max_load, the map
+// shrinks to the minimum capacity that respects max_load, but not below the minimum capacity of a non-empty map.
+// Because the map is then at least half as full as max_load allows (unless it is at that minimum capacity), its size
+// must halve again before the next shrink and double before the next growth.
+// If the key type has the CC_INCREMENTAL flag, the elements are migrated to the new storage over subsequent insertions
+// and erasures, and no shrinking occurs while a previous migration is still in progress.
+// Otherwise, or if CC_SMALL_PROBELEN is defined, a complete rehash occurs.
+// In the latter case, an incremental migration into the smaller table could stop short (see cc_map_migrate), whereas a
+// complete rehash that would exceed CC_MAP_PROBELEN_LIMIT simply fails.
+// In the case of allocation failure, or if the rehash would exceed that limit, the map is left unchanged.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_map_auto_shrink(
+  void *cntr,
+  void *other_ptr,
+  size_t el_size,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  double max_load,
+  double min_load,
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  // Also handles the placeholder and the default min load factor of zero.
+  if( cc_map_size( cntr ) >= cc_map_cap( cntr ) * CC_MIN( min_load, max_load / 4 ) )
+    return cc_make_allocing_fn_result( cntr, other_ptr );
+
+  size_t cap = cc_map_min_cap_for_n_els( CC_MAX( cc_map_size( cntr ), 1 ), max_load );
+  if( cap >= cc_map_cap( cntr ) || cc_map_old( cntr, layout ) )
+    return cc_make_allocing_fn_result( cntr, other_ptr );
+
+#ifndef CC_SMALL_PROBELEN
+  if( CC_HAS_FLAG( layout, CC_INCREMENTAL ) )
+  {
+    void *new_cntr = cc_map_begin_incremental_rehash( cntr, cap, el_size, layout, realloc_ );
+    return cc_make_allocing_fn_result( new_cntr ? new_cntr : cntr, other_ptr );
+  }
+#endif
+
+  void *new_cntr = cc_map_make_rehash( cntr, cap, el_size, layout, hash, realloc_, free_ );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, other_ptr );
+
+  cc_map_free( cntr, layout, free_ );
+
+  return cc_make_allocing_fn_result( new_cntr, other_ptr );
+}
+
+// Initializes a shallow copy of the source map.
+// The capacity of the copy is the same as the capacity of the source map, unless the source map is empty, in which case
+// the copy is a placeholder.
+// If the source map has an old table, it is also copied.
+// Hence, this function does no rehashing.
+// Returns a the pointer to the copy, or NULL in the case of allocation failure.
+// That return value is cast to bool in the corresponding macro.
+static inline void *cc_map_init_clone(
+  void *src,
+  size_t el_size,
+  uint64_t layout,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_map_size( src ) == 0 ) // Also handles placeholder.
+    return (void *)&cc_map_placeholder;
+
+  size_t alloc_size = cc_map_alloc_size( cc_map_cap( src ), el_size, layout );
+  cc_map_hdr_ty *new_cntr = (cc_map_hdr_ty*)realloc_( NULL, alloc_size );
+  if( !new_cntr )
+    return NULL;
+
+  memcpy( new_cntr, src, alloc_size );
+
+  void *old = cc_map_old( src, layout );
+  if( old )
+  {
+    size_t old_alloc_size = cc_map_alloc_size( cc_map_cap( old ), el_size, layout );
+    new_cntr->old = realloc_( NULL, old_alloc_size );
+    if( !new_cntr->old )
+    {
+      free_( new_cntr );
+      return NULL;
+    }
+
+    memcpy( new_cntr->old, old, old_alloc_size );
+  }
+
+  return new_cntr;
+}
+
+// Erases all elements, calling the destructors for the key and element types if necessary, without changing the map's
+// capacity.
+// If the map has an old table, it is freed.
+static inline void cc_map_clear(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
+{
+  if( cc_map_size( cntr ) == 0 && !cc_map_old( cntr, layout ) ) // Also handles placeholder map.
+    return;
+
+  void *tables[ 2 ] = { cc_map_old( cntr, layout ), cntr };
+  for( int t = 0; t < 2; ++t )
+  {
+    if( !tables[ t ] )
+      continue;
+
+    for( size_t i = 0; i < cc_map_hdr( tables[ t ] )->cap; ++i )
+      if( *cc_map_probelen( tables[ t ], i, el_size, layout ) )
+      {
+        if( key_dtor )
+          key_dtor( cc_map_key( tables[ t ], i, el_size, layout ) );
+
+        if( el_dtor )
+          el_dtor( cc_map_el( tables[ t ], i, el_size, layout ) );
+
+        *cc_map_probelen( tables[ t ], i, el_size, layout ) = 0;
+      }
+  }
+
+  if( cc_map_old( cntr, layout ) )
+  {
+    free_( cc_map_old( cntr, layout ) );
+    cc_map_hdr( cntr )->old = NULL;
+  }
+
+  if( CC_HAS_FLAG( layout, CC_METADATA ) )
+    memset( cc_map_metadata( cntr, el_size, layout ), 0, cc_map_hdr( cntr )->cap + CC_META_GROUP_SIZE );
+
+  cc_map_reset_occupancy( cntr, el_size, layout );
+  cc_map_hdr( cntr )->size = 0;
+  cc_map_hdr( cntr )->max_probelen = 0;
+}
+
+// Clears the map and frees its memory if is not a placeholder.
+static inline void cc_map_cleanup(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
+{
+  cc_map_clear( cntr, el_size, layout, el_dtor, key_dtor, free_ );
+
+  if( !cc_map_is_placeholder( cntr ) )
+    free_( cntr );
+}
+
+// For maps, the container handle doubles up as r_end.
+static inline void *cc_map_r_end(
+  void *cntr
+)
+{
+  return cntr;
+}
+
+// Returns a pointer-iterator to the end of the bucket array.
+static inline void *cc_map_end(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  return cc_map_el( cntr, cc_map_hdr( cntr )->cap, el_size, layout );
+}
+
+// Returns a pointer-iterator to the first element in the specified table at or after bucket index i, or NULL if there
+// is no such element.
+static inline void *cc_map_first_from( void *table, size_t i, size_t el_size, uint64_t layout )
+{
+  i = cc_map_occupied_from( table, i, el_size, layout );
+  return i == SIZE_MAX ? NULL : cc_map_el( table, i, el_size, layout );
+}
+
+// Returns a pointer-iterator to the last element in the specified table before bucket index i, or NULL if there is no
+// such element.
+static inline void *cc_map_last_before( void *table, size_t i, size_t el_size, uint64_t layout )
+{
+  i = cc_map_occupied_before( table, i, el_size, layout );
+  return i == SIZE_MAX ? NULL : cc_map_el( table, i, el_size, layout );
+}
 
-#define CC_PADDING( size, align ) ( ( ~(size) + 1 ) & ( (align) - 1 ) )
-#define CC_MAX( a, b ) ( (a) > (b) ? (a) : (b) )
+// Returns a pointer-iterator to the first element, or end if the map is empty.
+static inline void *cc_map_first(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  void *old = cc_map_old( cntr, layout );
+  if( old && cc_map_hdr( old )->size )
+    return cc_map_el( old, cc_map_hdr( old )->first, el_size, layout );
 
-#define CC_MAP_EL_PADDING( el_size, key_align ) \
-CC_PADDING( el_size, key_align )                \
+  if( cc_map_hdr( cntr )->size )
+    return cc_map_el( cntr, cc_map_hdr( cntr )->first, el_size, layout );
 
-#define CC_MAP_KEY_PADDING( el_size, key_size, key_align )                                            \
-CC_PADDING( el_size + CC_MAP_EL_PADDING( el_size, key_align ) + key_size, alignof( cc_probelen_ty ) ) \
+  return cc_map_end( cntr, el_size, layout );
+}
 
-#define CC_MAP_PROBELEN_PADDING( el_size, el_align, key_size, key_align )        \
-CC_PADDING(                                                                      \
-  el_size + CC_MAP_EL_PADDING( el_size, key_align ) + key_size +                 \
-  CC_MAP_KEY_PADDING( el_size, key_size, key_align ) + sizeof( cc_probelen_ty ), \
-  CC_MAX( key_align, CC_MAX( el_align, alignof( cc_probelen_ty ) ) )             \
-)                                                                                \
+// Returns a pointer-iterator to the last element, or r_end if the map is empty.
+static inline void *cc_map_last(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  if( cc_map_hdr( cntr )->size )
+    return cc_map_el( cntr, cc_map_hdr( cntr )->last, el_size, layout );
 
-#define CC_SET_EL_PADDING( el_size )             \
-CC_PADDING( el_size, alignof( cc_probelen_ty ) ) \
+  void *old = cc_map_old( cntr, layout );
+  if( old && cc_map_hdr( old )->size )
+    return cc_map_el( old, cc_map_hdr( old )->last, el_size, layout );
+
+  return cc_map_r_end( cntr );
+}
+
+static inline void *cc_map_prev(
+  void *cntr,
+  void *itr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  void *table = cc_map_itr_table( cntr, itr, el_size, layout );
+  void *prev = cc_map_last_before( table, cc_map_itr_index( table, itr, el_size, layout ), el_size, layout );
+  if( prev )
+    return prev;
+
+  // Elements in the old table precede those in the new table.
+  void *old = cc_map_old( cntr, layout );
+  if( table == cntr && old && ( prev = cc_map_last_before( old, cc_map_cap( old ), el_size, layout ) ) )
+    return prev;
+
+  return cc_map_r_end( cntr );
+}
+
+static inline void *cc_map_next(
+  void *cntr,
+  void *itr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  void *table = cc_map_itr_table( cntr, itr, el_size, layout );
+  void *next = cc_map_first_from( table, cc_map_itr_index( table, itr, el_size, layout ) + 1, el_size, layout );
+  if( next )
+    return next;
+
+  // Elements in the new table follow those in the old table.
+  if( table != cntr && ( next = cc_map_first_from( cntr, 0, el_size, layout ) ) )
+    return next;
+
+  return cc_map_end( cntr, el_size, layout );
+}
+
+// Statistics.
+// The histogram has a fixed size so that cc_stats_ty can be returned by value.
+
+#define CC_PROBELEN_HISTOGRAM_SIZE 16
+
+typedef struct
+{
+  size_t size;
+  size_t cap;
+  double max_load;
+  size_t bytes;
+  double mean_probelen;
+  size_t max_probelen;
+  size_t probelen_histogram[ CC_PROBELEN_HISTOGRAM_SIZE ];
+} cc_stats_ty;
+
+// Returns statistics describing the map, including any old table.
+// Unlike the header's max_probelen, which is only an upper bound, the probe lengths are read from the buckets.
+static inline cc_stats_ty cc_map_stats( void *cntr, size_t el_size, uint64_t layout, double max_load )
+{
+  cc_stats_ty result;
+  memset( &result, 0, sizeof( cc_stats_ty ) );
+  result.size = cc_map_size( cntr );
+  result.cap = cc_map_cap( cntr );
+  result.max_load = max_load;
+
+  if( cc_map_is_placeholder( cntr ) )
+    return result;
+
+  size_t total_probelen = 0;
+  void *tables[ 2 ] = { cc_map_old( cntr, layout ), cntr };
+  for( int t = 0; t < 2; ++t )
+  {
+    if( !tables[ t ] )
+      continue;
+
+    result.bytes += cc_map_alloc_size( cc_map_hdr( tables[ t ] )->cap, el_size, layout );
+
+    for(
+      size_t i = cc_map_occupied_from( tables[ t ], 0, el_size, layout );
+      i != SIZE_MAX;
+      i = cc_map_occupied_from( tables[ t ], i + 1, el_size, layout )
+    )
+    {
+      size_t probelen = *cc_map_probelen( tables[ t ], i, el_size, layout );
+      total_probelen += probelen;
+
+      if( probelen > result.max_probelen )
+        result.max_probelen = probelen;
+
+      ++result.probelen_histogram[
+        probelen < CC_PROBELEN_HISTOGRAM_SIZE ? probelen - 1 : CC_PROBELEN_HISTOGRAM_SIZE - 1
+      ];
+    }
+  }
+
+  if( result.size )
+    result.mean_probelen = (double)total_probelen / (double)result.size;
+
+  return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                        Set                                                         */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// A set is implemented as a map where the key and element are combined into one space in memory.
+// Hence, it reuses the functions for map, except:
+//   - The key offset inside the bucket is zero.
+//     This is handled at the API-macro level via the cc_layout function and associated macros.
+//   - The element size passed into map functions is zero in order to avoid double-memcpying.
+
+static inline size_t cc_set_size( void *cntr )
+{
+  return cc_map_size( cntr );
+}
+
+static inline size_t cc_set_cap( void *cntr )
+{
+  return cc_map_cap( cntr );
+}
+
+static inline cc_allocing_fn_result_ty cc_set_reserve(
+  void *cntr,
+  size_t n,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  double max_load,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_reserve( cntr, n, 0 /* Zero element size */, layout, hash, max_load, realloc_, free_ );
+}
+
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_set_insert(
+  void *cntr,
+  void *key,
+  bool replace,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_insert(
+    cntr,
+    cntr,     // Dummy pointer for element as memcpying to a NULL pointer is undefined behavior even when size is zero.
+    key,
+    replace,
+    0,        // Zero element size.
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    NULL,     // Dummy.
+    el_dtor,
+    NULL,     // Only one dtor.
+    realloc_,
+    free_
+  );
+}
+
+static inline CC_ALWAYS_INLINE void *cc_set_get(
+  void *cntr,
+  void *key,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  return cc_map_get( cntr, key, 0 /* Dummy */, layout, hash, cmpr );
+}
+
+static inline void cc_set_erase_itr(
+  void *cntr,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor )
+)
+{
+  cc_map_erase_itr( cntr, itr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */ );
+}
+
+static inline CC_ALWAYS_INLINE void *cc_set_erase(
+  void *cntr,
+  void *key,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_erase(
+    cntr,
+    key,
+    0,       // Zero element size.
+    layout,
+    hash,
+    cmpr,
+    el_dtor,
+    NULL,    // Only one dtor.
+    free_    // Needed to free the old table at the end of an incremental migration.
+  );
+}
+
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_set_insert_hashed(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  bool replace,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_insert_hashed(
+    cntr,
+    cntr,     // Dummy pointer for element as memcpying to a NULL pointer is undefined behavior even when size is zero.
+    key,
+    hash_val,
+    replace,
+    0,        // Zero element size.
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    el_dtor,
+    NULL,     // Only one dtor.
+    realloc_,
+    free_
+  );
+}
+
+static inline CC_ALWAYS_INLINE void *cc_set_get_hashed(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  return cc_map_get_hashed( cntr, key, hash_val, 0 /* Zero element size */, layout, cmpr );
+}
+
+static inline CC_ALWAYS_INLINE void *cc_set_erase_hashed(
+  void *cntr,
+  void *key,
+  size_t hash_val,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_erase_hashed(
+    cntr,
+    key,
+    hash_val,
+    0,       // Zero element size.
+    layout,
+    hash,
+    cmpr,
+    el_dtor,
+    NULL,    // Only one dtor.
+    free_
+  );
+}
+
+static inline CC_ALWAYS_INLINE size_t cc_set_get_n(
+  void *cntr,
+  void *keys,
+  size_t n,
+  void *out,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr
+)
+{
+  return cc_map_get_n( cntr, keys, n, out, 0 /* Zero element size */, layout, hash, cmpr );
+}
 
-#define CC_SET_PROBELEN_PADDING( el_size, el_align )                 \
-CC_PADDING(                                                          \
-  el_size + CC_SET_EL_PADDING( el_size ) + sizeof( cc_probelen_ty ), \
-  CC_MAX( el_align, alignof( cc_probelen_ty ) )                      \
-)                                                                    \
+static inline CC_ALWAYS_INLINE size_t cc_set_erase_keys(
+  void *cntr,
+  void *keys,
+  size_t n,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_erase_keys(
+    cntr,
+    keys,
+    n,
+    0,       // Zero element size.
+    layout,
+    hash,
+    cmpr,
+    el_dtor,
+    NULL,    // Only one dtor.
+    free_
+  );
+}
 
-// Struct for conveying key information from _Generic macro into below function.
-typedef struct
+static inline size_t cc_set_erase_if(
+  void *cntr,
+  cc_pred_fnptr_ty pred,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_free_fnptr_ty free_
+)
 {
-  uint64_t size;
-  uint64_t align;
-} cc_key_details_ty;
+  return cc_map_erase_if(
+    cntr,
+    pred,
+    0,       // Zero element size.
+    layout,
+    hash,
+    el_dtor,
+    NULL,    // Only one dtor.
+    free_
+  );
+}
 
-// Function for creating the uint64_t layout descriptor.
-// This function must be inlined in order for layout calculations to be optimized into a compile-time constant.
-#ifdef __GNUC__
-__attribute__((always_inline))
-#endif
-static inline uint64_t cc_layout( size_t cntr_id, uint64_t el_size, uint64_t el_align, cc_key_details_ty key_details )
+static inline cc_stats_ty cc_set_stats( void *cntr, CC_UNUSED( size_t, el_size ), uint64_t layout, double max_load )
 {
-  if( cntr_id == CC_MAP )
-    return
-      key_details.size                                                                        |
-      CC_MAP_EL_PADDING( el_size, key_details.align )                                   << 32 |
-      CC_MAP_KEY_PADDING( el_size, key_details.size, key_details.align )                << 40 |
-      CC_MAP_PROBELEN_PADDING( el_size, el_align, key_details.size, key_details.align ) << 48;
+  return cc_map_stats( cntr, 0 /* Zero element size */, layout, max_load );
+}
 
-  if( cntr_id == CC_SET )
-    return
-      el_size                                            |
-      (uint64_t)0                                  << 32 |
-      CC_SET_EL_PADDING( el_size )                 << 40 |
-      CC_SET_PROBELEN_PADDING( el_size, el_align ) << 48;
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_set_insert_keys(
+  void *cntr,
+  void *keys,
+  size_t n,
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_insert_keys(
+    cntr,
+    keys,
+    cntr,     // Dummy pointer for elements as memcpying to a NULL pointer is undefined behavior even when size is zero.
+    n,
+    0,        // Zero element size.
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    el_dtor,
+    NULL,     // Only one dtor.
+    realloc_,
+    free_
+  );
+}
 
-  return 0; // Other container types don't require layout data.
+static inline cc_allocing_fn_result_ty cc_set_shrink(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  double max_load,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_shrink( cntr, 0 /* Zero element size */, layout, hash, max_load, realloc_, free_ );
 }
 
-// Macros for extracting data from layout descriptor.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_set_auto_shrink(
+  void *cntr,
+  void *other_ptr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  double max_load,
+  double min_load,
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
+)
+{
+  return cc_map_auto_shrink(
+    cntr,
+    other_ptr,
+    0, // Zero element size.
+    layout,
+    hash,
+    max_load,
+    min_load,
+    NULL, // Dummy.
+    realloc_,
+    free_
+  );
+}
 
-#define CC_KEY_SIZE( layout ) (uint32_t)( layout )
+static inline void *cc_set_init_clone(
+  void *src,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_realloc_fnptr_ty realloc_,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  return cc_map_init_clone( src, /* Zero element size */ 0, layout, realloc_, NULL /* Dummy */ );
+}
 
-#define CC_KEY_OFFSET( el_size, layout ) ( (el_size) + (uint8_t)( layout >> 32 ) )
+static inline void cc_set_clear(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  cc_map_clear( cntr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */, NULL /* Dummy */ );
+}
 
-#define CC_PROBELEN_OFFSET( el_size, layout )                                           \
-( CC_KEY_OFFSET( el_size, layout ) + (uint32_t)( layout ) + (uint8_t)( layout >> 40 ) ) \
+static inline void cc_set_cleanup(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  void ( *el_dtor )( void * ),
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  void ( *free_ )( void * ))
+{
+  cc_map_cleanup( cntr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */, free_ );
+}
 
-#define CC_BUCKET_SIZE( el_size, layout )                                                        \
-( CC_PROBELEN_OFFSET( el_size, layout ) + sizeof( cc_probelen_ty ) + (uint8_t)( layout >> 48 ) ) \
+static inline void *cc_set_r_end( void *cntr )
+{
+  return cc_map_r_end( cntr );
+}
 
-// Return type for all functions that could reallocate a container's memory.
-// It contains a new container handle (the pointer may have changed to due reallocation) and an additional pointer whose
-// purpose depends on the function.
-// For functions that insert elements, that pointer points to the newly inserted elements, or NULL in the case of
-// allocation failure.
-// For other functions, that pointer is a dummy pointer that evaluates to true, or NULL in the case of allocation
-// failure (i.e. its only purpose is to convey whether the operation was successful).
-// The struct is aligned to max_align_t because the container handle must temporarily point to it (see
-// CC_POINT_HNDL_TO_ALLOCING_FN_RESULT below).
-typedef struct
+static inline void *cc_set_end(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
+)
 {
-  alignas( max_align_t )
-  void *new_cntr;
-  void *other_ptr;
-} cc_allocing_fn_result_ty;
+  return cc_map_end( cntr, /* Zero element size */ 0, layout );
+}
 
-// Helper function for one-line cc_allocing_fn_result_ty.
-static inline cc_allocing_fn_result_ty cc_make_allocing_fn_result( void *new_cntr, void *other_ptr )
+static inline void *cc_set_first(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
+)
 {
-  cc_allocing_fn_result_ty result;
-  result.new_cntr = new_cntr;
-  result.other_ptr = other_ptr;
-  return result;
+  return cc_map_first( cntr, /* Zero element size */ 0, layout );
 }
 
-// Performs memcpy and returns ptr.
-// Used in conjunction with cc_allocing_fn_result_ty (see below).
-static inline void *cc_memcpy_and_return_ptr( void *dest, void *src, size_t size, void *ptr )
+static inline void *cc_set_last(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
+)
 {
-  memcpy( dest, src, size );
-  return ptr;
+  return cc_map_last( cntr, /* Zero element size */ 0, layout );
 }
 
-// All macros that call functions that could cause memory reallocation do two essential things to circumvent limitations
-// of ISO C (such as the inability to declare variables in expressions and _Thread_local linking issues).
-// Firstly, they temporarily set the container handle to point to a temporary cc_insert_result object returned by the
-// call to the function (see CC_MAKE_LVAL_COPY above).
-#define CC_POINT_HNDL_TO_ALLOCING_FN_RESULT( cntr, fn_call )                           \
-  cntr = (CC_TYPEOF_XP( cntr ))&CC_MAKE_LVAL_COPY( cc_allocing_fn_result_ty, fn_call ) \
+static inline void *cc_set_prev(
+  void *cntr,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
+)
+{
+  return cc_map_prev( cntr, itr, /* Zero element size */ 0, layout );
+}
 
-// Secondly, they call cc_memcpy_and_return_ptr to restore the correct container handle (a new pointer in the case of
-// reallocation) and return a pointer, either to any new elements or to signify success/failure, to the user.
-// (In the latter case, that pointer is cast to bool in the API macro before being passed to the user.)
-// Without this call, we would be unable to access the new elements/success-or-failure pointer stored in the
-// cc_allocing_fn_result_ty after restoring the correct container handle.
-// Note that outside the function, a temporary container handle is created from the new handle in the
-// cc_allocing_fn_result_ty so that the later (void *) is properly converted to the correct handle type.
-// This new, correctly typed handle is then memcpy-ed over the user-supplied handle inside the function.
-#define CC_FIX_HNDL_AND_RETURN_OTHER_PTR( cntr )                                              \
-cc_memcpy_and_return_ptr(                                                                     \
-  &cntr,                                                                                      \
-  &CC_MAKE_LVAL_COPY( CC_TYPEOF_XP( cntr ), ( (cc_allocing_fn_result_ty *)cntr )->new_cntr ), \
-  sizeof( cntr ),                                                                             \
-  ( (cc_allocing_fn_result_ty *)cntr )->other_ptr                                             \
-)                                                                                             \
+static inline void *cc_set_next(
+  void *cntr,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
+)
+{
+  return cc_map_next( cntr, itr, /* Zero element size */ 0, layout );
+}
 
 /*--------------------------------------------------------------------------------------------------------------------*/
-/*                                                      Vector                                                        */
+/*                                                    Ordered map                                                     */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-// Vector header.
+// An ordered map is a B-tree whose nodes all live in a single allocation (the node pool) that follows the header.
+// Hence, nodes are addressed by uint32_t indices, and the whole tree is freed in one call.
+// Each node holds between CC_OMAP_MIN_KEYS( layout ) and CC_OMAP_MAX_KEYS( layout ) elements, except for the root, which
+// may hold fewer.
+// The maximum is chosen in cc_layout such that a node occupies roughly CC_OMAP_NODE_SIZE_TARGET bytes, i.e. a handful
+// of cache lines, so that each level of a search costs a few cache misses rather than one miss per key compared.
+// Unlike in a B+ tree, internal nodes hold elements too, so the tree never stores copies of keys that could outlive the
+// originals (a key may own memory that its destructor frees).
+// The layout of a node is:
+//   +-------------+----+--------------+----+--------------+----+----------------+----+
+//   |     #1      | #2 |      #3      | #4 |      #5      | #6 |       #7       | #8 |
+//   +-------------+----+--------------+----+--------------+----+----------------+----+
+//   #1 Node header.
+//   #2 Padding to max_align_t alignment.
+//   #3 CC_OMAP_MAX_KEYS( layout ) + 1 keys.
+//   #4 Padding to max_align_t alignment.
+//   #5 CC_OMAP_MAX_KEYS( layout ) + 1 elements.
+//   #6 Padding to max_align_t alignment.
+//   #7 CC_OMAP_MAX_KEYS( layout ) + 2 child indices (unused in leaves).
+//   #8 Padding to max_align_t alignment.
+// Keeping the keys in their own array means that a binary search within a node touches only the keys.
+// Each array has room for one extra entry so that an insertion can overflow a node before the node is split.
+// Each node records the index of its parent, which allows pointer-iterators to be plain element pointers: the node
+// containing an element is found from the element's offset into the node pool, and iteration climbs to the parent when
+// it runs off the end of a leaf.
+// As with sets, an ordered set is an ordered map whose element size is zero, in which case the key array doubles as the
+// element array.
+// Any insertion may reallocate the node pool and any insertion or erasure may move elements between nodes, so both
+// invalidate all pointer-iterators.
+
+// Ordered map header.
+// height is the number of levels in the tree, which bounds the number of nodes that one insertion can allocate.
+// Nodes that have been freed form a list, linked through their parent fields, starting at free_list.
+// n_nodes is the number of nodes that have ever been handed out of the pool, including freed ones.
+typedef struct
+{
+  alignas( max_align_t )
+  size_t size;
+  size_t height;
+  uint32_t root;
+  uint32_t free_list;
+  uint32_t n_free;
+  uint32_t n_nodes;
+  uint32_t node_cap;
+} cc_omap_hdr_ty;
+
+// Denotes the absence of a node (e.g. the root of an empty tree or the parent of the root).
+#define CC_OMAP_NO_NODE UINT32_MAX
+
+// Placeholder for ordered map with no allocated memory.
+static const cc_omap_hdr_ty cc_omap_placeholder = { 0, 0, CC_OMAP_NO_NODE, CC_OMAP_NO_NODE, 0, 0, 0 };
+
+// Node header.
+// A node on the free list has a zero element count, which allows cc_omap_clear to skip it.
 typedef struct
 {
-  alignas( max_align_t )
-  size_t size;
-  size_t cap;
-} cc_vec_hdr_ty;
-
-// Global placeholder for vector with no allocated storage.
-// In the case of vectors, the placeholder allows us to avoid checking for a NULL container handle inside functions.
-static const cc_vec_hdr_ty cc_vec_placeholder = { 0, 0 };
+  uint32_t parent;
+  uint16_t n;
+  bool leaf;
+} cc_omap_node_hdr_ty;
 
 // Easy header access function for internal use.
-static inline cc_vec_hdr_ty *cc_vec_hdr( void *cntr )
+static inline cc_omap_hdr_ty *cc_omap_hdr( void *cntr )
 {
-  return (cc_vec_hdr_ty *)cntr;
+  return (cc_omap_hdr_ty *)cntr;
 }
 
-static inline size_t cc_vec_size( void *cntr )
+static inline size_t cc_omap_size( void *cntr )
 {
-  return cc_vec_hdr( cntr )->size;
+  return cc_omap_hdr( cntr )->size;
 }
 
-static inline size_t cc_vec_cap( void *cntr )
+static inline bool cc_omap_is_placeholder( void *cntr )
 {
-  return cc_vec_hdr( cntr )->cap;
+  return cc_omap_hdr( cntr )->node_cap == 0;
 }
 
-static inline bool cc_vec_is_placeholder( void *cntr )
+// Functions for calculating the offsets of the arrays inside a node and the size of a node.
+
+#define CC_OMAP_ROUND_UP( size ) ( (size) + CC_PADDING( (size), alignof( max_align_t ) ) )
+
+static inline size_t cc_omap_els_offset( uint64_t layout )
 {
-  return cc_vec_hdr( cntr )->cap == 0;
+  return
+    CC_OMAP_ROUND_UP( sizeof( cc_omap_node_hdr_ty ) ) +
+    CC_OMAP_ROUND_UP( CC_KEY_SIZE( layout ) * ( CC_OMAP_MAX_KEYS( layout ) + (size_t)1 ) );
 }
 
-// Returns a pointer-iterator to the element at a specified index.
-static inline void *cc_vec_get(
-  void *cntr,
-  void *key, /* Pointer to size_t index */
-  size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr )
-)
+static inline size_t cc_omap_children_offset( size_t el_size, uint64_t layout )
 {
-  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * *(size_t *)key;
+  return cc_omap_els_offset( layout ) + CC_OMAP_ROUND_UP( el_size * ( CC_OMAP_MAX_KEYS( layout ) + (size_t)1 ) );
 }
 
-// Ensures that the capacity is large enough to support n elements without reallocation.
-// Returns a cc_allocing_fn_result_ty containing the new handle and a pointer that evaluates to true if the operation
-// was successful.
-static inline cc_allocing_fn_result_ty cc_vec_reserve(
-  void *cntr,
-  size_t n,
-  size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( double, max_load ),
-  cc_realloc_fnptr_ty realloc_,
-  CC_UNUSED( cc_free_fnptr_ty, free_ )
-)
+static inline size_t cc_omap_node_size( size_t el_size, uint64_t layout )
 {
-  if( cc_vec_cap( cntr ) >= n )
-    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+  return
+    cc_omap_children_offset( el_size, layout ) +
+    CC_OMAP_ROUND_UP( sizeof( uint32_t ) * ( CC_OMAP_MAX_KEYS( layout ) + (size_t)2 ) );
+}
 
-  bool is_placeholder = cc_vec_is_placeholder( cntr );
+// Functions for converting between node indices and node pointers.
 
-  cc_vec_hdr_ty *new_cntr = (cc_vec_hdr_ty *)realloc_(
-    is_placeholder ? NULL : cntr,
-    sizeof( cc_vec_hdr_ty ) + el_size * n
+static inline cc_omap_node_hdr_ty *cc_omap_node( void *cntr, uint32_t index, size_t el_size, uint64_t layout )
+{
+  return (cc_omap_node_hdr_ty *)(
+    (char *)cntr + sizeof( cc_omap_hdr_ty ) + cc_omap_node_size( el_size, layout ) * index
   );
-
-  if( !new_cntr )
-    return cc_make_allocing_fn_result( cntr, NULL );
-
-  if( is_placeholder )
-    new_cntr->size = 0;
-
-  new_cntr->cap = n;
-  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
 }
 
-// Inserts elements at the specified index.
-// Returns a cc_allocing_fn_result_ty containing the new handle and a pointer-iterator to the newly inserted elements.
-// If the underlying storage needed to be expanded and an allocation failure occurred, or if n is zero, the latter
-// pointer will be NULL.
-static inline cc_allocing_fn_result_ty cc_vec_insert_n(
-  void *cntr,
-  size_t index,
-  void *els,
-  size_t n,
-  size_t el_size,
-  void *( *realloc_ )( void *, size_t )
-)
+static inline uint32_t cc_omap_node_index( void *cntr, cc_omap_node_hdr_ty *node, size_t el_size, uint64_t layout )
 {
-  if( n == 0 )
-    return cc_make_allocing_fn_result( cntr, NULL );
-
-  if( cc_vec_size( cntr ) + n > cc_vec_cap( cntr ) )
-  {
-    size_t cap = cc_vec_cap( cntr );
-    if( !cap )
-      cap = 2;
-
-    while( cap < cc_vec_size( cntr ) + n )
-      cap *= 2;
-
-    cc_allocing_fn_result_ty result = cc_vec_reserve(
-      cntr,
-      cap,
-      el_size,
-      0, // Dummy.
-      NULL,            // Dummy.
-      0.0,             // Dummy.
-      realloc_,
-      NULL             // Dummy.
-    );
-    if( !result.other_ptr )
-      return result;
-
-    cntr = result.new_cntr;
-  }
+  return (uint32_t)(
+    ( (size_t)( (char *)node - (char *)cntr ) - sizeof( cc_omap_hdr_ty ) ) / cc_omap_node_size( el_size, layout )
+  );
+}
 
-  char *new_els = (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
-  memmove( new_els + n * el_size, new_els, el_size * ( cc_vec_hdr( cntr )->size - index ) );
-  memcpy( new_els, els, el_size * n );
-  cc_vec_hdr( cntr )->size += n;
+// Functions for easily accessing the key, element, and child arrays of a node.
 
-  return cc_make_allocing_fn_result( cntr, new_els );
+static inline void *cc_omap_key( cc_omap_node_hdr_ty *node, size_t i, uint64_t layout )
+{
+  return (char *)node + CC_OMAP_ROUND_UP( sizeof( cc_omap_node_hdr_ty ) ) + CC_KEY_SIZE( layout ) * i;
 }
 
-static inline cc_allocing_fn_result_ty cc_vec_insert(
-  void *cntr,
-  void *el,
-  void *key, // Pointer to size_t index.
-  CC_UNUSED( bool, replace ),
-  size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
-  CC_UNUSED( double, max_load ),
-  CC_UNUSED( cc_dtor_fnptr_ty, el_dtor ),
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  cc_realloc_fnptr_ty realloc_,
-  CC_UNUSED( cc_free_fnptr_ty, free_ )
-)
+static inline void *cc_omap_el( cc_omap_node_hdr_ty *node, size_t i, size_t el_size, uint64_t layout )
 {
-  return cc_vec_insert_n( cntr, *(size_t *)key, el, 1, el_size, realloc_ );
+  if( el_size == 0 ) // Ordered set.
+    return cc_omap_key( node, i, layout );
+
+  return (char *)node + cc_omap_els_offset( layout ) + el_size * i;
 }
 
-static inline cc_allocing_fn_result_ty cc_vec_push_n(
-  void *cntr,
-  void *els,
-  size_t n,
-  size_t el_size,
-  cc_realloc_fnptr_ty realloc_
-)
+static inline uint32_t *cc_omap_children( cc_omap_node_hdr_ty *node, size_t el_size, uint64_t layout )
 {
-  return cc_vec_insert_n( cntr, cc_vec_size( cntr ), els, n, el_size, realloc_ );
+  return (uint32_t *)( (char *)node + cc_omap_children_offset( el_size, layout ) );
 }
 
-static inline cc_allocing_fn_result_ty cc_vec_push(
+static inline cc_omap_node_hdr_ty *cc_omap_child(
   void *cntr,
-  void *el,
+  cc_omap_node_hdr_ty *node,
+  size_t i,
   size_t el_size,
-  cc_realloc_fnptr_ty realloc_
+  uint64_t layout
 )
 {
-  return cc_vec_push_n( cntr, el, 1, el_size, realloc_ );
+  return cc_omap_node( cntr, cc_omap_children( node, el_size, layout )[ i ], el_size, layout );
 }
 
-// Erases n elements at the specified index.
-// Returns a pointer-iterator to the element after the erased elements, or an end pointer-iterator if there is no
-// subsequent element.
-static inline void *cc_vec_erase_n(
+// Returns the index of child within node's child array.
+static inline size_t cc_omap_child_slot(
   void *cntr,
-  size_t index,
-  size_t n,
+  cc_omap_node_hdr_ty *node,
+  cc_omap_node_hdr_ty *child,
   size_t el_size,
-  cc_dtor_fnptr_ty el_dtor
+  uint64_t layout
 )
 {
-  if( n == 0 )
-    return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+  uint32_t child_index = cc_omap_node_index( cntr, child, el_size, layout );
+  uint32_t *children = cc_omap_children( node, el_size, layout );
+  size_t i = 0;
+  while( children[ i ] != child_index )
+    ++i;
 
-  if( el_dtor )
-    for( size_t j = 0; j < n; ++j )
-      el_dtor( (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( index + j ) );
+  return i;
+}
 
-  memmove(
-    (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index,
-    (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( index + n ),
-    ( cc_vec_hdr( cntr )->size - n - index ) * el_size
-  );
+// Functions for locating the node and slot of the element pointed to by a pointer-iterator.
 
-  cc_vec_hdr( cntr )->size -= n;
-  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * index;
+static inline cc_omap_node_hdr_ty *cc_omap_itr_node( void *cntr, void *itr, size_t el_size, uint64_t layout )
+{
+  size_t offset = (size_t)( (char *)itr - (char *)cc_omap_node( cntr, 0, el_size, layout ) );
+  return cc_omap_node( cntr, (uint32_t)( offset / cc_omap_node_size( el_size, layout ) ), el_size, layout );
 }
 
-// Shrinks vector's capacity to its current size.
-// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
-// operation was successful and false in the case of allocation failure.
-static inline void *cc_vec_erase(
-  void *cntr,
-  void *key, // Pointer to size_t index.
+static inline size_t cc_omap_itr_slot( cc_omap_node_hdr_ty *node, void *itr, size_t el_size, uint64_t layout )
+{
+  return (size_t)( (char *)itr - (char *)cc_omap_el( node, 0, el_size, layout ) ) /
+    ( el_size ? el_size : CC_KEY_SIZE( layout ) );
+}
+
+// Moves n keys and elements starting at slot src_i in node src to slot dst_i in node dst.
+// The ranges may overlap.
+static inline void cc_omap_move(
+  cc_omap_node_hdr_ty *dst,
+  size_t dst_i,
+  cc_omap_node_hdr_ty *src,
+  size_t src_i,
+  size_t n,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
-  cc_dtor_fnptr_ty el_dtor,
-  cc_dtor_fnptr_ty key_dtor,
-  CC_UNUSED( cc_free_fnptr_ty, free_ )
+  uint64_t layout
 )
 {
-  return cc_vec_erase_n( cntr, *(size_t *)key, 1, el_size, el_dtor );
+  memmove( cc_omap_key( dst, dst_i, layout ), cc_omap_key( src, src_i, layout ), CC_KEY_SIZE( layout ) * n );
+
+  if( el_size )
+    memmove( cc_omap_el( dst, dst_i, el_size, layout ), cc_omap_el( src, src_i, el_size, layout ), el_size * n );
 }
 
-// Sets the number of elements in the vector.
-// If n is below the current size, then the destructor is called for all erased elements.
-// In this case, the vector's capacity is not changed.
-// If n is above the current size, the new elements are uninitialized.
-// Returns a cc_allocing_fn_result_ty containing new container handle and a pointer that evaluates to true if the
-// operation was successful and false in the case of allocation failure.
-static inline cc_allocing_fn_result_ty cc_vec_resize(
+// Moves n child indices starting at slot src_i in node src to slot dst_i in node dst, updating the parent of each moved
+// child if the child changes nodes.
+static inline void cc_omap_move_children(
   void *cntr,
+  cc_omap_node_hdr_ty *dst,
+  size_t dst_i,
+  cc_omap_node_hdr_ty *src,
+  size_t src_i,
   size_t n,
   size_t el_size,
-  cc_dtor_fnptr_ty el_dtor,
-  cc_realloc_fnptr_ty realloc_
+  uint64_t layout
 )
 {
-  // No resize necessary (also handles placeholder).
-  if( n == cc_vec_size( cntr ) )
-    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+  uint32_t *dst_children = cc_omap_children( dst, el_size, layout );
+  memmove( dst_children + dst_i, cc_omap_children( src, el_size, layout ) + src_i, sizeof( uint32_t ) * n );
 
-  // Downsizing.
-  if( n < cc_vec_size( cntr ) )
+  if( dst != src )
   {
-    cc_vec_erase_n( cntr, n, cc_vec_size( cntr ) - n, el_size, el_dtor );
-    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+    uint32_t dst_index = cc_omap_node_index( cntr, dst, el_size, layout );
+    for( size_t i = dst_i; i < dst_i + n; ++i )
+      cc_omap_node( cntr, dst_children[ i ], el_size, layout )->parent = dst_index;
   }
+}
 
-  // Up-sizing.
-  cc_allocing_fn_result_ty result = cc_vec_reserve(
-    cntr,
-    n,
-    el_size,
-    0, // Dummy.
-    NULL,            // Dummy.
-    0.0,             // Dummy.
-    realloc_,
-    NULL             // Dummy.
-  );
-  if( !result.other_ptr )
-    return result;
-
-  cc_vec_hdr( result.new_cntr )->size = n;
+// Node pool management.
 
-  return result;
+// Returns the number of nodes that can be allocated without growing the node pool.
+static inline size_t cc_omap_nodes_available( void *cntr )
+{
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
+  return (size_t)hdr->node_cap - hdr->n_nodes + hdr->n_free;
 }
 
-static inline cc_allocing_fn_result_ty cc_vec_shrink(
+// Ensures that at least n more nodes can be allocated without growing the node pool.
+// The pool at least doubles when it grows, so that growth is amortized.
+// Returns the new container handle, or NULL in the case of allocation failure.
+static inline void *cc_omap_reserve_nodes(
   void *cntr,
+  size_t n,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( double, max_load ),
-  cc_realloc_fnptr_ty realloc_,
-  cc_free_fnptr_ty free_
+  uint64_t layout,
+  cc_realloc_fnptr_ty realloc_
 )
 {
-  if( cc_vec_size( cntr ) == cc_vec_cap( cntr ) ) // Also handles placeholder.
-    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+  if( cc_omap_nodes_available( cntr ) >= n )
+    return cntr;
 
-  if( cc_vec_size( cntr ) == 0 )
-  {
-    // Restore placeholder.
-    free_( cntr );
-    return cc_make_allocing_fn_result( (void *)&cc_vec_placeholder, cc_dummy_true_ptr );
-  }
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
+  size_t node_cap = CC_MAX( (size_t)hdr->node_cap * 2, (size_t)hdr->n_nodes - hdr->n_free + n );
+  if( node_cap >= CC_OMAP_NO_NODE )
+    node_cap = CC_OMAP_NO_NODE - 1;
 
-  cc_vec_hdr_ty *new_cntr = (cc_vec_hdr_ty *)realloc_( cntr, sizeof( cc_vec_hdr_ty ) + el_size * cc_vec_size( cntr ) );
+  size_t node_size = cc_omap_node_size( el_size, layout );
+  if(
+    node_cap - hdr->n_nodes + hdr->n_free < n ||
+    node_cap > ( SIZE_MAX - sizeof( cc_omap_hdr_ty ) ) / node_size
+  )
+    return NULL;
+
+  bool is_placeholder = cc_omap_is_placeholder( cntr );
+  cc_omap_hdr_ty *new_cntr = (cc_omap_hdr_ty *)realloc_(
+    is_placeholder ? NULL : cntr,
+    sizeof( cc_omap_hdr_ty ) + node_size * node_cap
+  );
   if( !new_cntr )
-    return cc_make_allocing_fn_result( cntr, NULL );
+    return NULL;
 
-  cc_vec_hdr( new_cntr )->cap = cc_vec_size( new_cntr );
-  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+  if( is_placeholder )
+    *new_cntr = cc_omap_placeholder;
+
+  new_cntr->node_cap = (uint32_t)node_cap;
+  return new_cntr;
 }
 
-// Initializes a shallow copy of the source vector.
-// The capacity of the new vector is the size of the source vector, not its capacity.
-// Returns a the pointer to the copy, or NULL in the case of allocation failure.
-// That return value is cast to bool in the corresponding macro.
-static inline void *cc_vec_init_clone(
-  void *src,
-  size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  cc_realloc_fnptr_ty realloc_,
-  CC_UNUSED( cc_free_fnptr_ty, free_ )
-)
+// Takes a node from the free list or, if the list is empty, from the unused tail of the node pool.
+// Nodes must have been reserved beforehand via cc_omap_reserve_nodes.
+static inline cc_omap_node_hdr_ty *cc_omap_alloc_node( void *cntr, bool leaf, size_t el_size, uint64_t layout )
 {
-  if( cc_vec_size( src ) == 0 )
-    return (void *)&cc_vec_placeholder;
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
+  cc_omap_node_hdr_ty *node;
 
-  cc_allocing_fn_result_ty result = cc_vec_resize(
-    (void *)&cc_vec_placeholder,
-    cc_vec_size( src ),
-    el_size,
-    NULL, // dtor unused.
-    realloc_
-  );
-
-  if( !result.other_ptr )
-    return NULL;
+  if( hdr->free_list != CC_OMAP_NO_NODE )
+  {
+    node = cc_omap_node( cntr, hdr->free_list, el_size, layout );
+    hdr->free_list = node->parent;
+    --hdr->n_free;
+  }
+  else
+    node = cc_omap_node( cntr, hdr->n_nodes++, el_size, layout );
 
-  memcpy(
-    (char *)result.new_cntr + sizeof( cc_vec_hdr_ty ),
-    (char *)src + sizeof( cc_vec_hdr_ty ),
-    el_size * cc_vec_size( src )
-  );
+  node->parent = CC_OMAP_NO_NODE;
+  node->n = 0;
+  node->leaf = leaf;
+  return node;
+}
 
-  return result.new_cntr;
+static inline void cc_omap_free_node( void *cntr, cc_omap_node_hdr_ty *node, size_t el_size, uint64_t layout )
+{
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
+  node->n = 0;
+  node->parent = hdr->free_list;
+  hdr->free_list = cc_omap_node_index( cntr, node, el_size, layout );
+  ++hdr->n_free;
 }
 
-// Erases all elements, calling their destructors if necessary.
-static inline void cc_vec_clear(
+// Searching.
+
+// Searches for the element with the specified key.
+// If it exists, *node_out and *slot_out are set to its location and true is returned.
+// Otherwise, they are set to the leaf and slot at which the key would be inserted (*node_out is NULL if the tree is
+// empty), and false is returned.
+static inline CC_ALWAYS_INLINE bool cc_omap_find(
   void *cntr,
+  void *key,
+  cc_omap_node_hdr_ty **node_out,
+  size_t *slot_out,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  CC_UNUSED( cc_free_fnptr_ty, free_ )
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  cc_vec_erase_n( cntr, 0, cc_vec_size( cntr ), el_size, el_dtor );
+  if( cc_omap_hdr( cntr )->root == CC_OMAP_NO_NODE ) // Also handles placeholder.
+  {
+    *node_out = NULL;
+    *slot_out = 0;
+    return false;
+  }
+
+  cc_omap_node_hdr_ty *node = cc_omap_node( cntr, cc_omap_hdr( cntr )->root, el_size, layout );
+  while( true )
+  {
+    size_t lo = 0;
+    size_t hi = node->n;
+    while( lo < hi )
+    {
+      size_t mid = ( lo + hi ) / 2;
+      int comparison = cmpr( key, cc_omap_key( node, mid, layout ) );
+      if( comparison == 0 )
+      {
+        *node_out = node;
+        *slot_out = mid;
+        return true;
+      }
+
+      if( comparison < 0 )
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+    if( node->leaf )
+    {
+      *node_out = node;
+      *slot_out = lo;
+      return false;
+    }
+
+    node = cc_omap_child( cntr, node, lo, el_size, layout );
+  }
 }
 
-// Clears the vector and frees its memory if it is not a placeholder.
-static inline void cc_vec_cleanup(
+static inline CC_ALWAYS_INLINE void *cc_omap_get(
   void *cntr,
+  void *key,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
-  cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  cc_free_fnptr_ty free_
+  uint64_t layout,
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  cc_vec_clear(
-    cntr,
-    el_size,
-    0, // Dummy.
-    el_dtor,
-    NULL,            // Dummy.
-    NULL             // Dummy.
-  );
+  cc_omap_node_hdr_ty *node;
+  size_t slot;
+  if( !cc_omap_find( cntr, key, &node, &slot, el_size, layout, cmpr ) )
+    return NULL;
 
-  if( !cc_vec_is_placeholder( cntr ) )
-    free_( cntr );
+  return cc_omap_el( node, slot, el_size, layout );
 }
 
-static inline void *cc_vec_end(
+// Returns a pointer to the key for the element pointed to by the specified pointer-iterator.
+static inline void *cc_omap_key_for(
   void *cntr,
+  void *itr,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout )
+  uint64_t layout
 )
 {
-  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * cc_vec_size( cntr );
+  cc_omap_node_hdr_ty *node = cc_omap_itr_node( cntr, itr, el_size, layout );
+  return cc_omap_key( node, cc_omap_itr_slot( node, itr, el_size, layout ), layout );
 }
 
-static inline void *cc_vec_next(
-  CC_UNUSED( void *, cntr ),
-  void *itr,
-  size_t el_size,
-  CC_UNUSED( uint64_t, layout )
-)
+// Iteration.
+// The container handle doubles up as r_end, and the address of the node pool (i.e. the address of the first node's
+// header, which is never an element) serves as end.
+
+static inline void *cc_omap_r_end( void *cntr )
 {
-  return (char *)itr + el_size;
+  return cntr;
 }
 
-static inline void *cc_vec_first(
+static inline void *cc_omap_end(
   void *cntr,
   CC_UNUSED( size_t, el_size ),
   CC_UNUSED( uint64_t, layout )
 )
 {
-  return (char *)cntr + sizeof( cc_vec_hdr_ty );
+  return (char *)cntr + sizeof( cc_omap_hdr_ty );
 }
 
-static inline void *cc_vec_last(
+// Returns a pointer-iterator to the first element in the subtree rooted at node.
+static inline void *cc_omap_subtree_first(
   void *cntr,
+  cc_omap_node_hdr_ty *node,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout )
+  uint64_t layout
 )
 {
-  return (char *)cntr + sizeof( cc_vec_hdr_ty ) + el_size * ( cc_vec_size( cntr ) - 1 );
-}
-
-/*--------------------------------------------------------------------------------------------------------------------*/
-/*                                                        List                                                        */
-/*--------------------------------------------------------------------------------------------------------------------*/
-
-// List is implemented a doubly linked list with sentinel nodes.
-
-// Node header.
-typedef struct cc_listnode_hdr_ty
-{
-  alignas( max_align_t )
-  struct cc_listnode_hdr_ty *prev;
-  struct cc_listnode_hdr_ty *next;
-} cc_listnode_hdr_ty;
-
-// List header.
-// It does not need to be aligned to alignof( max_align_t ) because no memory is allocated after the header.
-typedef struct
-{
-  size_t size;
-  cc_listnode_hdr_ty  r_end;
-  cc_listnode_hdr_ty  end;
-} cc_list_hdr_ty;
-
-// Placeholder for list with no allocated header.
-// The main purpose this serves is to provide every list with stable r_end and end iterators across translation units
-// and irrespective of whether any memory has been allocated for its header.
-// Every list initially (after cc_init) points to this placeholder, which differs across translation units, and is then
-// associated with that placeholder until cc_cleanup is called.
-// Calls to cc_r_end and cc_end on a list return pointers to the associated placeholder's r_end and end elements even
-// after a header has been dynamically allocated to it.
-// The way this works is that the placeholder's r_end.prev pointer points to the placeholder's r_end (i.e. a circular
-// link), and ditto for end.next.
-// Meanwhile, a list with an allocated header has it's r_end.prev pointer point to the placeholder's r_end, and ditto
-// for it's end.next pointer.
-// Therefore cc_list_hdr( cntr )->r_end.prev always produces the associated placeholder's r_end, and ditto for
-// cc_list_hdr( cntr )->end.next.
-// Unfortunately, this means that r_end and end must be handled as special cases during inserts, splices, and iteration.
-const static cc_list_hdr_ty cc_list_placeholder = {
-  0,
-  {
-    (cc_listnode_hdr_ty *)&cc_list_placeholder.r_end, // Circular link.
-    (cc_listnode_hdr_ty *)&cc_list_placeholder.end
-  },
-  {
-    (cc_listnode_hdr_ty *)&cc_list_placeholder.r_end,
-    (cc_listnode_hdr_ty *)&cc_list_placeholder.end    // Circular link.
-  }
-};
+  while( !node->leaf )
+    node = cc_omap_child( cntr, node, 0, el_size, layout );
 
-// Easy access to list header.
-static inline cc_list_hdr_ty *cc_list_hdr( void *cntr )
-{
-  return (cc_list_hdr_ty *)cntr;
+  return cc_omap_el( node, 0, el_size, layout );
 }
 
-// Easy access to a list node header from a pointer-iterator.
-static inline cc_listnode_hdr_ty *cc_listnode_hdr( void *itr )
+// Returns a pointer-iterator to the last element in the subtree rooted at node.
+static inline void *cc_omap_subtree_last(
+  void *cntr,
+  cc_omap_node_hdr_ty *node,
+  size_t el_size,
+  uint64_t layout
+)
 {
-  return (cc_listnode_hdr_ty *)( (char *)itr - sizeof( cc_listnode_hdr_ty ) );
-}
+  while( !node->leaf )
+    node = cc_omap_child( cntr, node, node->n, el_size, layout );
 
-// Easy access to a pointer-iterator from pointer to a list node header.
-static inline void *cc_list_el( void *hdr )
-{
-  return (char *)hdr + sizeof( cc_listnode_hdr_ty );
+  return cc_omap_el( node, node->n - (size_t)1, el_size, layout );
 }
 
-static inline bool cc_list_is_placeholder( void *cntr )
+static inline void *cc_omap_first(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout
+)
 {
-  return cc_list_hdr( cntr )->r_end.prev == &cc_list_hdr( cntr )->r_end;
-}
+  if( cc_omap_hdr( cntr )->root == CC_OMAP_NO_NODE )
+    return cc_omap_end( cntr, el_size, layout );
 
-static inline size_t cc_list_size( void *cntr )
-{
-  return cc_list_hdr( cntr )->size;
+  return cc_omap_subtree_first(
+    cntr,
+    cc_omap_node( cntr, cc_omap_hdr( cntr )->root, el_size, layout ),
+    el_size,
+    layout
+  );
 }
 
-static inline void *cc_list_r_end( void *cntr )
+static inline void *cc_omap_last(
+  void *cntr,
+  size_t el_size,
+  uint64_t layout
+)
 {
-  return cc_list_el( cc_list_hdr( cntr )->r_end.prev );
+  if( cc_omap_hdr( cntr )->root == CC_OMAP_NO_NODE )
+    return cc_omap_r_end( cntr );
+
+  return cc_omap_subtree_last(
+    cntr,
+    cc_omap_node( cntr, cc_omap_hdr( cntr )->root, el_size, layout ),
+    el_size,
+    layout
+  );
 }
 
-static inline void *cc_list_end(
+static inline void *cc_omap_next(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout )
+  void *itr,
+  size_t el_size,
+  uint64_t layout
 )
 {
-  return cc_list_el( cc_list_hdr( cntr )->end.next );
+  cc_omap_node_hdr_ty *node = cc_omap_itr_node( cntr, itr, el_size, layout );
+  size_t slot = cc_omap_itr_slot( node, itr, el_size, layout );
+
+  if( !node->leaf )
+    return cc_omap_subtree_first( cntr, cc_omap_child( cntr, node, slot + 1, el_size, layout ), el_size, layout );
+
+  if( slot + 1 < node->n )
+    return cc_omap_el( node, slot + 1, el_size, layout );
+
+  // Climb until we arrive at a parent from a child that is not its last.
+  while( node->parent != CC_OMAP_NO_NODE )
+  {
+    cc_omap_node_hdr_ty *parent = cc_omap_node( cntr, node->parent, el_size, layout );
+    slot = cc_omap_child_slot( cntr, parent, node, el_size, layout );
+    if( slot < parent->n )
+      return cc_omap_el( parent, slot, el_size, layout );
+
+    node = parent;
+  }
+
+  return cc_omap_end( cntr, el_size, layout );
 }
 
-static inline void *cc_list_prev(
+static inline void *cc_omap_prev(
   void *cntr,
   void *itr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout )
+  size_t el_size,
+  uint64_t layout
 )
 {
-  cc_listnode_hdr_ty *prev = cc_listnode_hdr( itr )->prev;
+  if( itr == cc_omap_end( cntr, el_size, layout ) )
+    return cc_omap_last( cntr, el_size, layout );
 
-  // If itr is r_end, then we need to decrement the iterator once more to ensure that the returned iterator is the r_end
-  // of the placeholder originally associated with the list.
-  if( prev == &cc_list_hdr( cntr )->r_end )
-    prev = prev->prev;
+  cc_omap_node_hdr_ty *node = cc_omap_itr_node( cntr, itr, el_size, layout );
+  size_t slot = cc_omap_itr_slot( node, itr, el_size, layout );
 
-  return cc_list_el( prev );
+  if( !node->leaf )
+    return cc_omap_subtree_last( cntr, cc_omap_child( cntr, node, slot, el_size, layout ), el_size, layout );
+
+  if( slot > 0 )
+    return cc_omap_el( node, slot - 1, el_size, layout );
+
+  // Climb until we arrive at a parent from a child that is not its first.
+  while( node->parent != CC_OMAP_NO_NODE )
+  {
+    cc_omap_node_hdr_ty *parent = cc_omap_node( cntr, node->parent, el_size, layout );
+    slot = cc_omap_child_slot( cntr, parent, node, el_size, layout );
+    if( slot > 0 )
+      return cc_omap_el( parent, slot - 1, el_size, layout );
+
+    node = parent;
+  }
+
+  return cc_omap_r_end( cntr );
 }
 
-static inline void *cc_list_next(
+// Returns a pointer-iterator to the first element whose key is not less than the specified key or, if upper is true, the
+// first element whose key is greater than the specified key.
+// If there is no such element, end is returned.
+// The candidate is updated at each level on the way down, as the answer is either in the subtree searched next or is
+// the element that bounds that subtree from above.
+static inline CC_ALWAYS_INLINE void *cc_omap_bound(
   void *cntr,
-  void *itr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout )
+  void *key,
+  bool upper,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  cc_listnode_hdr_ty *next = cc_listnode_hdr( itr )->next;
+  void *candidate = cc_omap_end( cntr, el_size, layout );
+  if( cc_omap_hdr( cntr )->root == CC_OMAP_NO_NODE ) // Also handles placeholder.
+    return candidate;
 
-  // See comment in cc_list_prev above.
-  if( next == &cc_list_hdr( cntr )->end )
-    next = next->next;
+  cc_omap_node_hdr_ty *node = cc_omap_node( cntr, cc_omap_hdr( cntr )->root, el_size, layout );
+  while( true )
+  {
+    size_t lo = 0;
+    size_t hi = node->n;
+    while( lo < hi )
+    {
+      size_t mid = ( lo + hi ) / 2;
+      int comparison = cmpr( key, cc_omap_key( node, mid, layout ) );
+      if( comparison == 0 && !upper )
+        return cc_omap_el( node, mid, el_size, layout );
+
+      if( comparison < 0 )
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
 
-  return cc_list_el( next );
+    if( lo < node->n )
+      candidate = cc_omap_el( node, lo, el_size, layout );
+
+    if( node->leaf )
+      return candidate;
+
+    node = cc_omap_child( cntr, node, lo, el_size, layout );
+  }
 }
 
-static inline void *cc_list_first(
+static inline CC_ALWAYS_INLINE void *cc_omap_lower_bound(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout )
+  void *key,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  return cc_list_next(
-    cntr,
-    cc_list_el( &cc_list_hdr( cntr )->r_end ),
-    0,              // Dummy.
-    0 // Dummy.
-  );
+  return cc_omap_bound( cntr, key, false, el_size, layout, cmpr );
 }
 
-static inline void *cc_list_last(
+static inline CC_ALWAYS_INLINE void *cc_omap_upper_bound(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout )
+  void *key,
+  size_t el_size,
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  return cc_list_prev(
-    cntr,
-    cc_list_el( &cc_list_hdr( cntr )->end ),
-    0,              // Dummy.
-    0 // Dummy.
-  );
+  return cc_omap_bound( cntr, key, true, el_size, layout, cmpr );
 }
 
-// Allocates a header for a list that is currently a placeholder.
-// Returns the new container handle, or NULL in the case of allocation failure.
-static inline void *cc_list_alloc_hdr(
+// Insertion.
+
+// Inserts the specified key and element at the specified slot in the specified leaf (or into a new root if node is
+// NULL), then splits any nodes that overflow, from the bottom up.
+// A split leaves the first half of the elements in the node, moves the median up into the parent, and moves the second
+// half into a new right sibling.
+// The new element's location is tracked through the splits.
+// If el is NULL, the new element is left uninitialized.
+// At least height + 1 nodes must have been reserved beforehand.
+// Returns a pointer-iterator to the new element.
+static inline void *cc_omap_insert_at(
   void *cntr,
-  cc_realloc_fnptr_ty realloc_
+  cc_omap_node_hdr_ty *node,
+  size_t slot,
+  void *key,
+  void *el,
+  size_t el_size,
+  uint64_t layout
 )
 {
-  cc_list_hdr_ty *new_cntr = (cc_list_hdr_ty *)realloc_( NULL, sizeof( cc_list_hdr_ty ) );
-  if( !new_cntr )
-    return NULL;
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
+
+  if( !node )
+  {
+    node = cc_omap_alloc_node( cntr, true, el_size, layout );
+    hdr->root = cc_omap_node_index( cntr, node, el_size, layout );
+    hdr->height = 1;
+  }
+
+  cc_omap_move( node, slot + 1, node, slot, node->n - slot, el_size, layout );
+  memcpy( cc_omap_key( node, slot, layout ), key, CC_KEY_SIZE( layout ) );
+  if( el )
+    memcpy( cc_omap_el( node, slot, el_size, layout ), el, el_size );
+
+  ++node->n;
+  ++hdr->size;
+
+  cc_omap_node_hdr_ty *new_el_node = node;
+  size_t median = ( CC_OMAP_MAX_KEYS( layout ) + (size_t)1 ) / 2;
+
+  while( node->n > CC_OMAP_MAX_KEYS( layout ) )
+  {
+    cc_omap_node_hdr_ty *right = cc_omap_alloc_node( cntr, node->leaf, el_size, layout );
+    right->n = (uint16_t)( node->n - median - 1 );
+    cc_omap_move( right, 0, node, median + 1, right->n, el_size, layout );
+    if( !node->leaf )
+      cc_omap_move_children( cntr, right, 0, node, median + 1, right->n + (size_t)1, el_size, layout );
 
-  new_cntr->r_end.next = &new_cntr->end;
-  new_cntr->end.prev = &new_cntr->r_end;
+    node->n = (uint16_t)median;
 
-  // Link the new header's r_end and end with the original placeholder's r_end and end.
-  new_cntr->r_end.prev = &cc_list_hdr( cntr )->r_end;
-  new_cntr->end.next = &cc_list_hdr( cntr )->end;
+    cc_omap_node_hdr_ty *parent;
+    size_t parent_slot;
+    if( node->parent == CC_OMAP_NO_NODE )
+    {
+      parent = cc_omap_alloc_node( cntr, false, el_size, layout );
+      hdr->root = cc_omap_node_index( cntr, parent, el_size, layout );
+      ++hdr->height;
+      cc_omap_children( parent, el_size, layout )[ 0 ] = cc_omap_node_index( cntr, node, el_size, layout );
+      node->parent = hdr->root;
+      parent_slot = 0;
+    }
+    else
+    {
+      parent = cc_omap_node( cntr, node->parent, el_size, layout );
+      parent_slot = cc_omap_child_slot( cntr, parent, node, el_size, layout );
+    }
 
-  new_cntr->size = 0; 
-  return new_cntr;
-}
+    cc_omap_move( parent, parent_slot + 1, parent, parent_slot, parent->n - parent_slot, el_size, layout );
+    cc_omap_move_children(
+      cntr,
+      parent,
+      parent_slot + 2,
+      parent,
+      parent_slot + 1,
+      parent->n - parent_slot,
+      el_size,
+      layout
+    );
+    cc_omap_move( parent, parent_slot, node, median, 1, el_size, layout );
+    cc_omap_children( parent, el_size, layout )[ parent_slot + 1 ] =
+      cc_omap_node_index( cntr, right, el_size, layout );
+    right->parent = cc_omap_node_index( cntr, parent, el_size, layout );
+    ++parent->n;
 
-// Attaches a node to the list before the node pointed to by the specified pointer-iterator.
-static inline void cc_list_attach( void *cntr, void *itr, cc_listnode_hdr_ty *node )
-{
-  // Handle r_end and end iterators as a special case.
-  // We need to convert the iterator from the global placeholder's r_end or end to the local r_end or end.
-  if( itr == cc_list_r_end( cntr ) )
-    itr = cc_list_el( &cc_list_hdr( cntr )->r_end );
-  else if( itr == cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ ) )
-    itr = cc_list_el( &cc_list_hdr( cntr )->end );
+    if( new_el_node == node )
+    {
+      if( slot == median )
+      {
+        new_el_node = parent;
+        slot = parent_slot;
+      }
+      else if( slot > median )
+      {
+        new_el_node = right;
+        slot -= median + 1;
+      }
+    }
 
-  // Link node.
-  node->next = cc_listnode_hdr( itr );
-  node->prev = node->next->prev;
-  node->next->prev = node;
-  node->prev->next = node;
+    node = parent;
+  }
+
+  return cc_omap_el( new_el_node, slot, el_size, layout );
 }
 
-// Inserts an element into the list before the node pointed to by a given pointer-iterator.
+// Inserts an element.
+// If replace is true, then the new element replaces any existing element with the same key.
+// If el is NULL, the inserted or replacing element is left uninitialized.
+// The search happens before any nodes are reserved, so finding an existing element never reallocates the node pool.
 // Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer-iterator to the newly inserted
-// element (or NULL in the case of allocation failure).
-static inline cc_allocing_fn_result_ty cc_list_insert(
+// element (or to the existing element with the same key if replace is false).
+// If the node pool must grow but allocation fails, the pointer-iterator is NULL and the tree is unchanged.
+static inline cc_allocing_fn_result_ty cc_omap_insert(
   void *cntr,
   void *el,
-  void *key, // Pointer to void pointer-interator.
-  CC_UNUSED( bool, replace ),
+  void *key,
+  bool replace,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
+  uint64_t layout,
   CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
+  cc_cmpr_fnptr_ty cmpr,
   CC_UNUSED( double, max_load ),
-  CC_UNUSED( cc_dtor_fnptr_ty, el_dtor ),
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  CC_UNUSED( size_t, max_probelen ),
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
   cc_realloc_fnptr_ty realloc_,
   CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  if( cc_list_is_placeholder( cntr ) )
+  cc_omap_node_hdr_ty *node;
+  size_t slot;
+  if( cc_omap_find( cntr, key, &node, &slot, el_size, layout, cmpr ) )
   {
-    void *new_cntr = cc_list_alloc_hdr( cntr, realloc_ );
-    if( !new_cntr )
-      return cc_make_allocing_fn_result( cntr, NULL );
+    if( replace )
+    {
+      if( key_dtor )
+        key_dtor( cc_omap_key( node, slot, layout ) );
 
-    cntr = new_cntr;
-  }
+      if( el_dtor )
+        el_dtor( cc_omap_el( node, slot, el_size, layout ) );
 
-  cc_listnode_hdr_ty *new_node = (cc_listnode_hdr_ty *)realloc_( NULL, sizeof( cc_listnode_hdr_ty ) + el_size );
-  if( !new_node )
-    return cc_make_allocing_fn_result( cntr, NULL );
+      memcpy( cc_omap_key( node, slot, layout ), key, CC_KEY_SIZE( layout ) );
+      if( el )
+        memcpy( cc_omap_el( node, slot, el_size, layout ), el, el_size );
+    }
 
-  memcpy( cc_list_el( new_node ), el, el_size );
+    return cc_make_allocing_fn_result( cntr, cc_omap_el( node, slot, el_size, layout ) );
+  }
 
-  // Handle r_end and end iterators as a special case.
-  // We need to convert the iterator from the associated placeholder's r_end or end to the local r_end or end.
-  if( *(void **)key == cc_list_r_end( cntr ) )
-    *(void **)key = cc_list_el( &cc_list_hdr( cntr )->r_end );
-  else if( *(void **)key == cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ ) )
-    *(void **)key = cc_list_el( &cc_list_hdr( cntr )->end );
+  if( cc_omap_nodes_available( cntr ) < cc_omap_hdr( cntr )->height + 1 )
+  {
+    uint32_t node_index = node ? cc_omap_node_index( cntr, node, el_size, layout ) : CC_OMAP_NO_NODE;
 
-  cc_list_attach( cntr, *(void **)key, new_node );
+    void *new_cntr = cc_omap_reserve_nodes( cntr, cc_omap_hdr( cntr )->height + 1, el_size, layout, realloc_ );
+    if( !new_cntr )
+      return cc_make_allocing_fn_result( cntr, NULL );
 
-  ++cc_list_hdr( cntr )->size;
+    cntr = new_cntr;
+    if( node )
+      node = cc_omap_node( cntr, node_index, el_size, layout );
+  }
 
-  return cc_make_allocing_fn_result( cntr, cc_list_el( new_node ) );  
+  return cc_make_allocing_fn_result( cntr, cc_omap_insert_at( cntr, node, slot, key, el, el_size, layout ) );
 }
 
-static inline cc_allocing_fn_result_ty cc_list_push(
+// Inserts an uninitialized element for the caller to construct in place if no element with the specified key exists.
+// *inserted is set to whether the element was inserted, which is determined by comparing the ordered map's size before
+// and after the insertion.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer-iterator to the new or existing
+// element, or NULL in the case of memory allocation failure.
+static inline cc_allocing_fn_result_ty cc_omap_get_or_insert_uninit(
   void *cntr,
-  void *el,
+  void *key,
+  bool *inserted,
   size_t el_size,
-  cc_realloc_fnptr_ty realloc_
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_realloc_fnptr_ty realloc_,
+  cc_free_fnptr_ty free_
 )
 {
-  return cc_list_insert(
+  size_t size = cc_omap_size( cntr );
+
+  cc_allocing_fn_result_ty result = cc_omap_insert(
     cntr,
-    el,
-    &CC_MAKE_LVAL_COPY( void *, cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ ) ),
-    false,           // Dummy.
+    NULL,
+    key,
+    false,
     el_size,
-    0, // Dummy.
-    NULL,            // Dummy.
-    NULL,            // Dummy.
-    0.0,             // Dummy.
-    NULL,            // Dummy.
-    NULL,            // Dummy.
+    layout,
+    hash,
+    cmpr,
+    max_load,
+    max_probelen,
+    NULL, // Dummy.
+    el_dtor,
+    key_dtor,
     realloc_,
-    NULL             // Dummy.
+    free_
   );
+
+  *inserted = result.other_ptr && cc_omap_size( result.new_cntr ) != size;
+  return result;
 }
 
-// Erases the element pointed to by a given pointer-iterator and returns a pointer-iterator to next element (or end if
-// the element was the last element in the list).
-static inline void *cc_list_erase(
+// Builds the tree in an empty ordered map from n elements whose keys are in strictly ascending order.
+// Each element is appended to the rightmost leaf.
+// When a node on the right spine is full, the element instead becomes the separator between that node and a new, empty
+// right sibling, which receives subsequent elements, and the same rule is applied one level up.
+// Hence, every node left of the spine is full.
+// Finally, each spine node that is left with fewer than CC_OMAP_MIN_KEYS( layout ) elements borrows the difference from
+// its full left sibling, from the top down.
+// Nodes must have been reserved beforehand.
+static inline void cc_omap_build_sorted(
   void *cntr,
-  void *key, // Pointer to void pointer-interator.
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout ),
-  CC_UNUSED( cc_hash_fnptr_ty, hash ),
-  CC_UNUSED( cc_cmpr_fnptr_ty, cmpr ),
-  cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  cc_free_fnptr_ty free_
+  void *keys,
+  void *els,
+  size_t n,
+  size_t el_size,
+  uint64_t layout
 )
 {
-  cc_listnode_hdr_ty *hdr = cc_listnode_hdr( *(void **)key );
-  cc_listnode_hdr_ty *next = hdr->next;
-  hdr->prev->next = next;
-  next->prev = hdr->prev;
-  
-  if( el_dtor )
-    el_dtor( *(void **)key );
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
 
-  free_( hdr );
-  --cc_list_hdr( cntr )->size;
+  cc_omap_node_hdr_ty *leaf = cc_omap_alloc_node( cntr, true, el_size, layout );
+  hdr->root = cc_omap_node_index( cntr, leaf, el_size, layout );
+  hdr->height = 1;
 
-  // If next is end, we need to make sure we're returning the associated placeholder's end.
-  if( next == &cc_list_hdr( cntr )->end )
-    next = next->next;
+  for( size_t i = 0; i < n; ++i )
+  {
+    cc_omap_node_hdr_ty *node = leaf;
+    cc_omap_node_hdr_ty *right = NULL;
 
-  return cc_list_el( next );
-}
+    while( node->n == CC_OMAP_MAX_KEYS( layout ) )
+    {
+      cc_omap_node_hdr_ty *sibling = cc_omap_alloc_node( cntr, node->leaf, el_size, layout );
+      if( right )
+      {
+        cc_omap_children( sibling, el_size, layout )[ 0 ] = cc_omap_node_index( cntr, right, el_size, layout );
+        right->parent = cc_omap_node_index( cntr, sibling, el_size, layout );
+      }
+      else
+        leaf = sibling;
 
-// Removes the element pointed to by pointer-iterator src_itr from the source list and attaches it to the list before
-// pointer-iterator itr.
-// Although this function never allocates memory for the element/node itself, it must allocate the list's header if the
-// list is currently a placeholder.
-// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
-// operation was successful or false in the case of allocation failure.
-static inline cc_allocing_fn_result_ty cc_list_splice(
-  void *cntr,
-  void *itr,
-  void *src,
-  void *src_itr,
-  cc_realloc_fnptr_ty realloc_
-)
-{
-  if( cc_list_is_placeholder( cntr ) )
-  {
-    void *new_cntr = cc_list_alloc_hdr( cntr, realloc_ );
-    if( !new_cntr )
-      return cc_make_allocing_fn_result( cntr, NULL );
+      if( node->parent == CC_OMAP_NO_NODE )
+      {
+        cc_omap_node_hdr_ty *root = cc_omap_alloc_node( cntr, false, el_size, layout );
+        hdr->root = cc_omap_node_index( cntr, root, el_size, layout );
+        ++hdr->height;
+        cc_omap_children( root, el_size, layout )[ 0 ] = cc_omap_node_index( cntr, node, el_size, layout );
+        node->parent = hdr->root;
+      }
 
-    cntr = new_cntr;
+      right = sibling;
+      node = cc_omap_node( cntr, node->parent, el_size, layout );
+    }
+
+    memcpy( cc_omap_key( node, node->n, layout ), (char *)keys + CC_KEY_SIZE( layout ) * i, CC_KEY_SIZE( layout ) );
+    memcpy( cc_omap_el( node, node->n, el_size, layout ), (char *)els + el_size * i, el_size );
+    if( right )
+    {
+      cc_omap_children( node, el_size, layout )[ node->n + 1 ] = cc_omap_node_index( cntr, right, el_size, layout );
+      right->parent = cc_omap_node_index( cntr, node, el_size, layout );
+    }
+
+    ++node->n;
   }
 
-  cc_listnode_hdr( src_itr )->prev->next = cc_listnode_hdr( src_itr )->next;
-  cc_listnode_hdr( src_itr )->next->prev = cc_listnode_hdr( src_itr )->prev;
-  cc_list_attach( cntr, itr, cc_listnode_hdr( src_itr ) );
+  hdr->size = n;
 
-  --cc_list_hdr( src )->size;
-  ++cc_list_hdr( cntr )->size;
+  cc_omap_node_hdr_ty *node = cc_omap_node( cntr, hdr->root, el_size, layout );
+  while( !node->leaf )
+  {
+    cc_omap_node_hdr_ty *child = cc_omap_child( cntr, node, node->n, el_size, layout );
+    if( child->n < CC_OMAP_MIN_KEYS( layout ) )
+    {
+      cc_omap_node_hdr_ty *left = cc_omap_child( cntr, node, node->n - (size_t)1, el_size, layout );
+      size_t k = CC_OMAP_MIN_KEYS( layout ) - child->n;
+
+      cc_omap_move( child, k, child, 0, child->n, el_size, layout );
+      cc_omap_move( child, k - 1, node, node->n - (size_t)1, 1, el_size, layout );
+      cc_omap_move( child, 0, left, left->n - k + 1, k - 1, el_size, layout );
+      cc_omap_move( node, node->n - (size_t)1, left, left->n - k, 1, el_size, layout );
+      if( !child->leaf )
+      {
+        cc_omap_move_children( cntr, child, k, child, 0, child->n + (size_t)1, el_size, layout );
+        cc_omap_move_children( cntr, child, 0, left, left->n - k + 1, k, el_size, layout );
+      }
 
-  return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+      left->n = (uint16_t)( left->n - k );
+      child->n = (uint16_t)( child->n + k );
+    }
+
+    node = child;
+  }
 }
 
-// Initializes a shallow copy of the source list.
-// This requires allocating memory for every node, as well as for the list's header unless src is a placeholder.
-// Returns a the pointer to the copy, or NULL in the case of allocation failure.
-// That return value is cast to bool in the corresponding macro.
-static inline void *cc_list_init_clone(
-  void *src,
+// Returns an upper bound on the height of a tree holding n elements.
+// A tree of height h holds at least 2 * ( CC_OMAP_MIN_KEYS( layout ) + 1 )^( h - 1 ) - 1 elements.
+static inline size_t cc_omap_max_height( size_t n, uint64_t layout )
+{
+  size_t height = 1;
+  size_t fanout = CC_OMAP_MIN_KEYS( layout ) + (size_t)1;
+  for( size_t min_fill = fanout; min_fill * 2 - 1 <= n && min_fill <= SIZE_MAX / 2 / fanout; min_fill *= fanout )
+    ++height;
+
+  return height;
+}
+
+// Inserts the n elements in array els with the corresponding keys in array keys, replacing any existing elements with
+// the same keys.
+// Enough nodes for the final tree are reserved first, so either all elements are inserted or, in the case of allocation
+// failure, none are.
+// Because every node other than the root holds at least CC_OMAP_MIN_KEYS( layout ) elements, the tree never has more
+// than size / CC_OMAP_MIN_KEYS( layout ) + 1 nodes, and each insertion additionally requires height + 1 nodes to be
+// available.
+// If the map is empty and the keys are in strictly ascending order, the tree is built directly with full nodes via
+// cc_omap_build_sorted, which is much faster than inserting the elements one by one.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
+// operation was successful and false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_omap_insert_keys(
+  void *cntr,
+  void *keys,
+  void *els,
+  size_t n,
   size_t el_size,
-  CC_UNUSED( uint64_t, layout ),
+  uint64_t layout,
+  cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
+  double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
   cc_realloc_fnptr_ty realloc_,
   cc_free_fnptr_ty free_
 )
 {
-  cc_allocing_fn_result_ty result = { (void *)&cc_list_placeholder, cc_dummy_true_ptr };
+  if( n == 0 )
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
 
-  for(
-    void *i = cc_list_first( src, 0 /* Dummy */, 0 /* Dummy */ );
-    i != cc_list_end( src, 0 /* Dummy */, 0 /* Dummy */ );
-    i = cc_list_next( src, i, 0 /* Dummy */, 0 /* Dummy */ )
-  )
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
+  size_t live_nodes = (size_t)hdr->n_nodes - hdr->n_free;
+  size_t nodes_needed =
+    ( hdr->size + n ) / CC_OMAP_MIN_KEYS( layout ) + cc_omap_max_height( hdr->size + n, layout ) + 2;
+  if( nodes_needed > live_nodes )
   {
-    result = cc_list_insert(
-      result.new_cntr,
-      i,
-      &CC_MAKE_LVAL_COPY(
-        void *,
-        cc_list_end( result.new_cntr, 0 /* Dummy */, 0 /* Dummy */ )
-      ),
-      false,           // Dummy.
-      el_size,
-      0, // Dummy.
-      NULL,            // Dummy.
-      NULL,            // Dummy.
-      0.0,             // Dummy.
-      NULL,            // Dummy.
-      NULL,            // Dummy.
-      realloc_,
-      NULL             // Dummy.
-    );
+    void *new_cntr = cc_omap_reserve_nodes( cntr, nodes_needed - live_nodes, el_size, layout, realloc_ );
+    if( !new_cntr )
+      return cc_make_allocing_fn_result( cntr, NULL );
 
-    if( !result.other_ptr )
-    {
-      // Erase incomplete clone without invoking destructors.
-      
-      void *j = cc_list_first( result.new_cntr, 0 /* Dummy */, 0 /* Dummy */ );
-      while( j != cc_list_end( result.new_cntr, 0 /* Dummy */, 0 /* Dummy */ ) )
-      {
-        void *next = cc_list_next( result.new_cntr, j, 0 /* Dummy */, 0 /* Dummy */ );
-        free_( cc_listnode_hdr( j ) );
-        j = next;
-      }
+    cntr = new_cntr;
+  }
 
-      if( !cc_list_is_placeholder( result.new_cntr ) )
-        free_( result.new_cntr );
+  bool sorted = cc_omap_size( cntr ) == 0;
+  for( size_t i = 1; sorted && i < n; ++i )
+    sorted = cmpr(
+      (char *)keys + CC_KEY_SIZE( layout ) * ( i - 1 ),
+      (char *)keys + CC_KEY_SIZE( layout ) * i
+    ) < 0;
 
-      return NULL;
-    }
+  if( sorted )
+  {
+    cc_omap_build_sorted( cntr, keys, els, n, el_size, layout );
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
   }
 
-  return result.new_cntr;
-}
-
-// Erases all elements, calling their destructors if necessary.
-static inline void cc_list_clear(
-  void *cntr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout ),
-  cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  cc_free_fnptr_ty free_
-)
-{
-  while(
-    cc_list_first( cntr, 0 /* Dummy */, 0 /* Dummy */ ) !=
-    cc_list_end( cntr, 0 /* Dummy */, 0 /* Dummy */ )
-  )
-    cc_list_erase(
+  // The reservation above ensures that none of these insertions can reallocate the node pool.
+  for( size_t i = 0; i < n; ++i )
+    cc_omap_insert(
       cntr,
-      &CC_MAKE_LVAL_COPY( void *, cc_list_first( cntr, 0 /* Dummy */, 0 /* Dummy */ ) ),
-      0,               // Dummy.
-      0, // Dummy.
-      NULL,            // Dummy.
-      NULL,            // Dummy.
+      (char *)els + el_size * i,
+      (char *)keys + CC_KEY_SIZE( layout ) * i,
+      true,
+      el_size,
+      layout,
+      hash,
+      cmpr,
+      max_load,
+      max_probelen,
+      NULL, // Dummy.
       el_dtor,
-      NULL,            // Dummy.
+      key_dtor,
+      realloc_,
       free_
     );
+
+  return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
 }
 
-// Erases all elements, calling their destructors if necessary, and frees memory for the list's header if it is not
-// a placeholder.
-static inline void cc_list_cleanup(
+// Erasure.
+
+// Restores the minimum element count in node, which has just lost an element, by rotating an element from a sibling
+// that can spare one through the parent or, failing that, by merging the node, the separating parent element, and a
+// sibling.
+// A merge removes an element from the parent, so the process repeats one level up.
+// If the root is left empty, its only child (if any) becomes the new root.
+static inline void cc_omap_rebalance(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
-  CC_UNUSED( uint64_t, layout ),
-  cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  cc_free_fnptr_ty free_
+  cc_omap_node_hdr_ty *node,
+  size_t el_size,
+  uint64_t layout
 )
 {
-  cc_list_clear( cntr, 0 /* Dummy */, 0 /* Dummy */, el_dtor, NULL /* Dummy */, free_ );
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
 
-  if( !cc_list_is_placeholder( cntr ) )
-    free_( cntr );
-}
+  while( node->parent != CC_OMAP_NO_NODE && node->n < CC_OMAP_MIN_KEYS( layout ) )
+  {
+    cc_omap_node_hdr_ty *parent = cc_omap_node( cntr, node->parent, el_size, layout );
+    size_t slot = cc_omap_child_slot( cntr, parent, node, el_size, layout );
+    cc_omap_node_hdr_ty *left = slot > 0 ? cc_omap_child( cntr, parent, slot - 1, el_size, layout ) : NULL;
+    cc_omap_node_hdr_ty *right = slot < parent->n ? cc_omap_child( cntr, parent, slot + 1, el_size, layout ) : NULL;
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/*                                                        Map                                                         */
-/*--------------------------------------------------------------------------------------------------------------------*/
+    if( left && left->n > CC_OMAP_MIN_KEYS( layout ) )
+    {
+      cc_omap_move( node, 1, node, 0, node->n, el_size, layout );
+      cc_omap_move( node, 0, parent, slot - 1, 1, el_size, layout );
+      cc_omap_move( parent, slot - 1, left, left->n - (size_t)1, 1, el_size, layout );
+      if( !node->leaf )
+      {
+        cc_omap_move_children( cntr, node, 1, node, 0, node->n + (size_t)1, el_size, layout );
+        cc_omap_move_children( cntr, node, 0, left, left->n, 1, el_size, layout );
+      }
 
-// Map header.
-typedef struct
-{
-  alignas( max_align_t )
-  size_t size;
-  size_t cap;
-} cc_map_hdr_ty;
+      --left->n;
+      ++node->n;
+      return;
+    }
 
-// Placeholder for map with no allocated memory.
-// In the case of maps, this placeholder allows us to avoid checking for a NULL handle inside functions.
-static const cc_map_hdr_ty cc_map_placeholder = { 0, 0 };
+    if( right && right->n > CC_OMAP_MIN_KEYS( layout ) )
+    {
+      cc_omap_move( node, node->n, parent, slot, 1, el_size, layout );
+      cc_omap_move( parent, slot, right, 0, 1, el_size, layout );
+      cc_omap_move( right, 0, right, 1, right->n - (size_t)1, el_size, layout );
+      if( !node->leaf )
+      {
+        cc_omap_move_children( cntr, node, node->n + (size_t)1, right, 0, 1, el_size, layout );
+        cc_omap_move_children( cntr, right, 0, right, 1, right->n, el_size, layout );
+      }
 
-// Easy header access function for internal use.
-static inline cc_map_hdr_ty *cc_map_hdr( void *cntr )
-{
-  return (cc_map_hdr_ty *)cntr;
-}
+      --right->n;
+      ++node->n;
+      return;
+    }
 
-// Size and capacity.
+    // Merge the right node of the pair into the left one.
+    if( left )
+    {
+      right = node;
+      --slot;
+    }
+    else
+      left = node;
 
-static inline size_t cc_map_size( void *cntr )
-{
-  return cc_map_hdr( cntr )->size;
-}
+    cc_omap_move( left, left->n, parent, slot, 1, el_size, layout );
+    cc_omap_move( left, left->n + (size_t)1, right, 0, right->n, el_size, layout );
+    if( !left->leaf )
+      cc_omap_move_children( cntr, left, left->n + (size_t)1, right, 0, right->n + (size_t)1, el_size, layout );
 
-static inline size_t cc_map_cap( void *cntr )
-{
-  return cc_map_hdr( cntr )->cap;
-}
+    left->n = (uint16_t)( left->n + 1 + right->n );
+    cc_omap_free_node( cntr, right, el_size, layout );
 
-static inline bool cc_map_is_placeholder( void *cntr )
-{
-  return cc_map_cap( cntr ) == 0;
-}
+    cc_omap_move( parent, slot, parent, slot + 1, parent->n - slot - 1, el_size, layout );
+    cc_omap_move_children( cntr, parent, slot + 1, parent, slot + 2, parent->n - slot - 1, el_size, layout );
+    --parent->n;
 
-// Functions for easily accessing element, key, and probe length for the bucket at index i.
-// The element pointer also denotes the beginning of the bucket.
+    node = parent;
+  }
 
-static inline void *cc_map_el( void *cntr, size_t i, size_t el_size, uint64_t layout )
-{
-  return (char *)cntr + sizeof( cc_map_hdr_ty ) + CC_BUCKET_SIZE( el_size, layout ) * i;
-}
+  if( node->parent == CC_OMAP_NO_NODE && node->n == 0 )
+  {
+    if( node->leaf )
+    {
+      hdr->root = CC_OMAP_NO_NODE;
+      hdr->height = 0;
+    }
+    else
+    {
+      hdr->root = cc_omap_children( node, el_size, layout )[ 0 ];
+      cc_omap_node( cntr, hdr->root, el_size, layout )->parent = CC_OMAP_NO_NODE;
+      --hdr->height;
+    }
 
-static inline void *cc_map_key( void *cntr, size_t i, size_t el_size, uint64_t layout )
-{
-  return (char *)cc_map_el( cntr, i, el_size, layout ) + CC_KEY_OFFSET( el_size, layout );
+    cc_omap_free_node( cntr, node, el_size, layout );
+  }
 }
 
-static inline cc_probelen_ty *cc_map_probelen( void *cntr, size_t i, size_t el_size, uint64_t layout )
+// Removes the element at the specified slot in the specified node without calling any destructors.
+// An element in an internal node is overwritten with its predecessor, which is always the last element in a leaf, and
+// that element is removed instead.
+static inline void cc_omap_erase_at(
+  void *cntr,
+  cc_omap_node_hdr_ty *node,
+  size_t slot,
+  size_t el_size,
+  uint64_t layout
+)
 {
-  return (cc_probelen_ty *)( (char *)cc_map_el( cntr, i, el_size, layout ) + CC_PROBELEN_OFFSET( el_size, layout ) );
+  if( !node->leaf )
+  {
+    cc_omap_node_hdr_ty *leaf = cc_omap_child( cntr, node, slot, el_size, layout );
+    while( !leaf->leaf )
+      leaf = cc_omap_child( cntr, leaf, leaf->n, el_size, layout );
+
+    cc_omap_move( node, slot, leaf, leaf->n - (size_t)1, 1, el_size, layout );
+    node = leaf;
+    slot = leaf->n - (size_t)1;
+  }
+
+  cc_omap_move( node, slot, node, slot + 1, node->n - slot - 1, el_size, layout );
+  --node->n;
+  --cc_omap_hdr( cntr )->size;
+
+  cc_omap_rebalance( cntr, node, el_size, layout );
 }
 
-// Inserts an element into the map.
-// Assumes that the map has empty slots and therefore that failure cannot occur (hence the "raw" label).
-// If replace is true, then el will replace any existing element with the same key.
-// Returns a pointer-iterator to the newly inserted element, or to the existing element with the same key if replace is
-// false.
-// For the exact mechanics of Robin-Hood hashing, see Sebastian Sylvan's helpful article:
-// www.sebastiansylvan.com/post/robin-hood-hashing-should-be-your-default-hash-table-implementation
-// However, this function includes an optimization not mentioned in descriptions of Robin Hood hashing.
-// Specifically, it enters a second, inner loop once a swap occurs.
-// This allows us to eliminate some checks and branching based on whether the element to insert has already been placed,
-// albeit at the cost of longer code.
-static inline void *cc_map_insert_raw(
+static inline void cc_omap_erase_itr(
   void *cntr,
-  void *el,
-  void *key,
-  bool replace,
+  void *itr,
   size_t el_size,
   uint64_t layout,
-  cc_hash_fnptr_ty hash,
-  cc_cmpr_fnptr_ty cmpr,
   cc_dtor_fnptr_ty el_dtor,
   cc_dtor_fnptr_ty key_dtor
 )
 {
-  size_t i = hash( key ) & ( cc_map_hdr( cntr )->cap - 1 );
-  cc_probelen_ty probelen = 1;
-
-  while( true )
-  {
-    if( probelen > *cc_map_probelen( cntr, i, el_size, layout ) )
-    {
-      // Empty bucket, or stealing occupied bucket.
-      void *to_return = cc_map_el( cntr, i, el_size, layout );
-      ++cc_map_hdr( cntr )->size;
-
-      while( true )
-      {
-        if( !*cc_map_probelen( cntr, i, el_size, layout ) )
-        {
-          memcpy( cc_map_key( cntr, i, el_size, layout ), key, CC_KEY_SIZE( layout ) );
-          memcpy( cc_map_el( cntr, i, el_size, layout ), el, el_size );
-          *cc_map_probelen( cntr, i, el_size, layout ) = probelen;
-          return to_return;
-        }
+  cc_omap_node_hdr_ty *node = cc_omap_itr_node( cntr, itr, el_size, layout );
+  size_t slot = cc_omap_itr_slot( node, itr, el_size, layout );
 
-        if( probelen > *cc_map_probelen( cntr, i, el_size, layout ) )
-        {
-          CC_MEMSWAP( key, cc_map_key( cntr, i, el_size, layout ), CC_KEY_SIZE( layout ) );
-          CC_MEMSWAP( el, cc_map_el( cntr, i, el_size, layout ), el_size );
+  if( key_dtor )
+    key_dtor( cc_omap_key( node, slot, layout ) );
 
-          cc_probelen_ty temp_probelen = *cc_map_probelen( cntr, i, el_size, layout );
-          *cc_map_probelen( cntr, i, el_size, layout ) = probelen;
-          probelen = temp_probelen;
-        }
+  if( el_dtor )
+    el_dtor( cc_omap_el( node, slot, el_size, layout ) );
 
-        i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-        ++probelen;
-      }
-    }
-    else if(
-      probelen == *cc_map_probelen( cntr, i, el_size, layout ) &&
-      cmpr( cc_map_key( cntr, i, el_size, layout ), key ) == 0
-    )
-    {
-      // Same key.
+  cc_omap_erase_at( cntr, node, slot, el_size, layout );
+}
 
-      if( replace )
-      {
-        if( key_dtor )
-          key_dtor( cc_map_key( cntr, i, el_size, layout ) );
+// Erases the element with the specified key, if it exists.
+// Returns a pointer that evaluates to true if an element was erased, or else is NULL.
+// This pointer is eventually cast to bool by the cc_erase API macro.
+static inline CC_ALWAYS_INLINE void *cc_omap_erase(
+  void *cntr,
+  void *key,
+  size_t el_size,
+  uint64_t layout,
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  cc_omap_node_hdr_ty *node;
+  size_t slot;
+  if( !cc_omap_find( cntr, key, &node, &slot, el_size, layout, cmpr ) )
+    return NULL;
 
-        if( el_dtor )
-          el_dtor( cc_map_el( cntr, i, el_size, layout ) );
+  cc_omap_erase_itr( cntr, cc_omap_el( node, slot, el_size, layout ), el_size, layout, el_dtor, key_dtor );
+  return cc_dummy_true_ptr;
+}
 
-        memcpy( cc_map_key( cntr, i, el_size, layout ), key, CC_KEY_SIZE( layout ) );
-        memcpy( cc_map_el( cntr, i, el_size, layout ), el, el_size );
-      }
+// Initializes a shallow copy of the source ordered map.
+// Only the part of the node pool that has been handed out is copied.
+// Returns a the pointer to the copy, or NULL in the case of allocation failure.
+// That return value is cast to bool in the corresponding macro.
+static inline void *cc_omap_init_clone(
+  void *src,
+  size_t el_size,
+  uint64_t layout,
+  cc_realloc_fnptr_ty realloc_,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  if( cc_omap_size( src ) == 0 ) // Also handles placeholder.
+    return (void *)&cc_omap_placeholder;
 
-      return cc_map_el( cntr, i, el_size, layout );
-    }
+  size_t alloc_size = sizeof( cc_omap_hdr_ty ) + cc_omap_node_size( el_size, layout ) * cc_omap_hdr( src )->n_nodes;
+  cc_omap_hdr_ty *new_cntr = (cc_omap_hdr_ty *)realloc_( NULL, alloc_size );
+  if( !new_cntr )
+    return NULL;
 
-    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-    ++probelen;
-  }
+  memcpy( new_cntr, src, alloc_size );
+  new_cntr->node_cap = new_cntr->n_nodes;
+  return new_cntr;
 }
 
-// Same as previous function, except for elements with keys known not to already exist in the map.
-// This function is used for rehashing when the map's capacity changes.
-// When we known that the key is new, we can skip certain checks and achieve a small performance improvement.
-static inline void *cc_map_insert_raw_unique(
+// Erases all elements, calling the destructors for the key and element types if necessary, without freeing the node
+// pool.
+static inline void cc_omap_clear(
   void *cntr,
-  void *el,
-  void *key,
   size_t el_size,
   uint64_t layout,
-  cc_hash_fnptr_ty hash
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  size_t i = hash( key ) & ( cc_map_hdr( cntr )->cap - 1 );
-  cc_probelen_ty probelen = 1;
+  if( cc_omap_is_placeholder( cntr ) )
+    return;
 
-  while( true )
-  {
-    if( probelen > *cc_map_probelen( cntr, i, el_size, layout ) )
-    {
-      // Empty bucket, or stealing occupied bucket.
-      void *to_return = cc_map_el( cntr, i, el_size, layout );
-      ++cc_map_hdr( cntr )->size;
+  cc_omap_hdr_ty *hdr = cc_omap_hdr( cntr );
 
-      while( true )
+  if( el_dtor || key_dtor )
+    for( uint32_t i = 0; i < hdr->n_nodes; ++i )
+    {
+      cc_omap_node_hdr_ty *node = cc_omap_node( cntr, i, el_size, layout );
+      for( size_t j = 0; j < node->n; ++j )
       {
-        if( !*cc_map_probelen( cntr, i, el_size, layout ) )
-        {
-          memcpy( cc_map_key( cntr, i, el_size, layout ), key, CC_KEY_SIZE( layout ) );
-          memcpy( cc_map_el( cntr, i, el_size, layout ), el, el_size );
-          *cc_map_probelen( cntr, i, el_size, layout ) = probelen;
-          return to_return;
-        }
-
-        if( probelen > *cc_map_probelen( cntr, i, el_size, layout ) )
-        {
-          CC_MEMSWAP( key, cc_map_key( cntr, i, el_size, layout ), CC_KEY_SIZE( layout ) );
-          CC_MEMSWAP( el, cc_map_el( cntr, i, el_size, layout ), el_size );
-
-          cc_probelen_ty temp_probelen = *cc_map_probelen( cntr, i, el_size, layout );
-          *cc_map_probelen( cntr, i, el_size, layout ) = probelen;
-          probelen = temp_probelen;
-        }
+        if( key_dtor )
+          key_dtor( cc_omap_key( node, j, layout ) );
 
-        i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-        ++probelen;
+        if( el_dtor )
+          el_dtor( cc_omap_el( node, j, el_size, layout ) );
       }
     }
 
-    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-    ++probelen;
-  }
-}
-
-// Returns the minimum capacity required to accommodate n elements, which is governed by the max load factor associated
-// with the map's key type.
-static inline size_t cc_map_min_cap_for_n_els( size_t n, double max_load )
-{
-  if( n == 0 )
-    return 0;
-
-  // Round up to power of 2.
-  size_t cap = 8;
-  while( n > cap * max_load )
-    cap *= 2;
-
-  return cap;
+  hdr->size = 0;
+  hdr->height = 0;
+  hdr->root = CC_OMAP_NO_NODE;
+  hdr->free_list = CC_OMAP_NO_NODE;
+  hdr->n_free = 0;
+  hdr->n_nodes = 0;
 }
 
-// Creates a rehashed duplicate of cntr with capacity cap.
-// Assumes that cap is large enough to accommodate all elements in cntr without violating the max load factor.
-// Returns pointer to the duplicate, or NULL in the case of allocation failure.
-static inline void *cc_map_make_rehash(
+// Clears the ordered map and frees its memory if is not a placeholder.
+static inline void cc_omap_cleanup(
   void *cntr,
-  size_t cap,
   size_t el_size,
   uint64_t layout,
-  cc_hash_fnptr_ty hash,
-  cc_realloc_fnptr_ty realloc_
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
 )
 {
-  cc_map_hdr_ty *new_cntr = (cc_map_hdr_ty *)realloc_(
-    NULL,
-    sizeof( cc_map_hdr_ty ) + CC_BUCKET_SIZE( el_size, layout ) * cap
-  );
-  if( !new_cntr )
-    return NULL;
+  cc_omap_clear( cntr, el_size, layout, el_dtor, key_dtor, free_ );
 
-  new_cntr->size = 0;
-  new_cntr->cap = cap;
-  for( size_t i = 0; i < cap; ++i )
-    *cc_map_probelen( new_cntr, i, el_size, layout ) = 0;
+  if( !cc_omap_is_placeholder( cntr ) )
+    free_( cntr );
+}
 
-  for( size_t i = 0; i < cc_map_hdr( cntr )->cap; ++i )
-    if( *cc_map_probelen( cntr, i, el_size, layout ) )
-      cc_map_insert_raw_unique(
-        new_cntr,
-        cc_map_el( cntr, i, el_size, layout ),
-        cc_map_key( cntr, i, el_size, layout ),
-        el_size,
-        layout,
-        hash
-      );
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                    Ordered set                                                     */
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-  return new_cntr;
+// An ordered set is an ordered map whose element size is zero, so that the key array in each node doubles as the
+// element array (see the Set section above for the same approach applied to hash tables).
+
+static inline size_t cc_oset_size( void *cntr )
+{
+  return cc_omap_size( cntr );
 }
 
-// Reserves capacity such that the map can accommodate n elements without reallocation (i.e. without violating the
-// max load factor).
-// Returns a cc_allocing_fn_result_ty containing new container handle and a pointer that evaluates to true if the
-// operation successful or false in the case of allocation failure.
-static inline cc_allocing_fn_result_ty cc_map_reserve(
+static inline cc_allocing_fn_result_ty cc_oset_insert(
   void *cntr,
-  size_t n,
-  size_t el_size,
+  void *key,
+  bool replace,
   uint64_t layout,
   cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
   double max_load,
+  size_t max_probelen,
+  cc_dtor_fnptr_ty el_dtor,
   cc_realloc_fnptr_ty realloc_,
   cc_free_fnptr_ty free_
 )
 {
-  size_t cap = cc_map_min_cap_for_n_els( n, max_load );
-
-  if( cc_map_cap( cntr ) >= cap )
-    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
-
-  void *new_cntr = cc_map_make_rehash(
+  return cc_omap_insert(
     cntr,
-    cap,
-    el_size,
+    cntr,     // Dummy pointer for element as memcpying to a NULL pointer is undefined behavior even when size is zero.
+    key,
+    replace,
+    0,        // Zero element size.
     layout,
     hash,
-    realloc_
+    cmpr,
+    max_load,
+    max_probelen,
+    NULL,     // Dummy.
+    el_dtor,
+    NULL,     // Only one dtor.
+    realloc_,
+    free_
   );
-  if( !new_cntr )
-    return cc_make_allocing_fn_result( cntr, NULL );
-
-  if( !cc_map_is_placeholder( cntr ) )
-    free_( cntr );
-
-  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
 }
 
-// Inserts an element.
-// If replace is true, then el replaces any existing element with the same key.
-// If the map exceeds its load factor, the underlying storage is expanded and a complete rehash occurs.
-// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer to the newly inserted element,
-// or to the existing element with the same key if replace is false.
-// If the underlying storage needed to be expanded and an allocation failure occurred, the latter pointer will be NULL.
-// This function checks to ensure that the map could accommodate an insertion before searching for the existing element.
-// Therefore, failure can occur even if an element with the same key already exists and no reallocation was actually
-// necessary.
-// This was a design choice in favor of code simplicity and readability over ideal behavior in a corner case.
-static inline cc_allocing_fn_result_ty cc_map_insert(
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_oset_insert_keys(
   void *cntr,
-  void *el,
-  void *key,
-  bool replace,
-  size_t el_size,
+  void *keys,
+  size_t n,
   uint64_t layout,
   cc_hash_fnptr_ty hash,
   cc_cmpr_fnptr_ty cmpr,
   double max_load,
+  size_t max_probelen,
   cc_dtor_fnptr_ty el_dtor,
-  cc_dtor_fnptr_ty key_dtor,
   cc_realloc_fnptr_ty realloc_,
   cc_free_fnptr_ty free_
 )
 {
-  if( cc_map_size( cntr ) + 1 > cc_map_cap( cntr ) * max_load )
-  {
-    cc_allocing_fn_result_ty result = cc_map_reserve(
-      cntr,
-      cc_map_size( cntr ) + 1,
-      el_size,
-      layout,
-      hash,
-      max_load,
-      realloc_,
-      free_
-    );
-
-    if( !result.other_ptr )
-      return result;
-
-    cntr = result.new_cntr;
-  }
-
-  void *new_el = cc_map_insert_raw(
+  return cc_omap_insert_keys(
     cntr,
-    el,
-    key,
-    replace,
-    el_size,
+    keys,
+    cntr,     // Dummy pointer for elements as memcpying to a NULL pointer is undefined behavior even when size is zero.
+    n,
+    0,        // Zero element size.
     layout,
     hash,
     cmpr,
+    max_load,
+    max_probelen,
     el_dtor,
-    key_dtor
+    NULL,     // Only one dtor.
+    realloc_,
+    free_
   );
-
-  return cc_make_allocing_fn_result( cntr, new_el );
 }
 
-// Returns a pointer-iterator to the element with the specified key, or NULL if no such element exists.
-static inline void *cc_map_get(
+static inline CC_ALWAYS_INLINE void *cc_oset_get(
   void *cntr,
   void *key,
-  size_t el_size,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
   cc_hash_fnptr_ty hash,
   cc_cmpr_fnptr_ty cmpr
 )
 {
-  if( cc_map_size( cntr ) == 0 )
-    return NULL;
-
-  size_t i = hash( key ) & ( cc_map_hdr( cntr )->cap - 1 );
-  cc_probelen_ty probelen = 1;
-
-  while( probelen <= *cc_map_probelen( cntr, i, el_size, layout ) )
-  {
-    if(
-      probelen == *cc_map_probelen( cntr, i, el_size, layout ) &&
-      cmpr( cc_map_key( cntr, i, el_size, layout ), key ) == 0
-    )
-      return cc_map_el( cntr, i, el_size, layout );
-
-    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-    ++probelen;
-  }
-
-  return NULL;
+  return cc_omap_get( cntr, key, 0 /* Zero element size */, layout, hash, cmpr );
 }
 
-// Returns a pointer to the key for the element pointed to by the specified pointer-iterator.
-static inline void *cc_map_key_for(
-  void *itr,
-  size_t el_size,
-  uint64_t layout
+static inline CC_ALWAYS_INLINE void *cc_oset_lower_bound(
+  void *cntr,
+  void *key,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  return (char *)itr + CC_KEY_OFFSET( el_size, layout );
+  return cc_omap_lower_bound( cntr, key, 0 /* Zero element size */, layout, cmpr );
 }
 
-// Erases the element pointer to by pointer-iterator itr.
-// For the exact mechanics of erasing elements in a Robin-Hood hash table, see Sebastian Sylvan's:
-// www.sebastiansylvan.com/post/more-on-robin-hood-hashing-2/
-static inline void cc_map_erase_itr(
+static inline CC_ALWAYS_INLINE void *cc_oset_upper_bound(
   void *cntr,
-  void *itr,
-  size_t el_size,
+  void *key,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
-  cc_dtor_fnptr_ty el_dtor,
-  cc_dtor_fnptr_ty key_dtor
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  size_t i = ( (char *)itr - (char *)cc_map_el( cntr, 0, el_size, layout ) ) / CC_BUCKET_SIZE( el_size, layout );
-  *cc_map_probelen( cntr, i, el_size, layout ) = 0;
-  --cc_map_hdr( cntr )->size;
-
-  if( key_dtor )
-    key_dtor( cc_map_key( cntr, i, el_size, layout ) );
-
-  if( el_dtor )
-    el_dtor( cc_map_el( cntr, i, el_size, layout ) );
-
-  while( true )
-  {
-    size_t next = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-    if( *cc_map_probelen( cntr, next, el_size, layout ) <= 1 )
-      break; // Empty slot or key already in its home bucket, so all done.
-    
-    //Bump backwards.
-
-    memcpy(
-      cc_map_key( cntr, i, el_size, layout ),
-      cc_map_key( cntr, next, el_size, layout ),
-      CC_KEY_SIZE( layout )
-    );
-    memcpy( cc_map_el( cntr, i, el_size, layout ), cc_map_el( cntr, next, el_size, layout ), el_size );
-
-    *cc_map_probelen( cntr, i, el_size, layout ) =
-      *cc_map_probelen( cntr, next, el_size, layout ) - 1;
-    *cc_map_probelen( cntr, next, el_size, layout ) = 0;
-
-    i = next;
-  }
+  return cc_omap_upper_bound( cntr, key, 0 /* Zero element size */, layout, cmpr );
 }
 
-// Erases the element with the specified key, if it exists.
-// Returns a pointer that evaluates to true if an element was erased, or else is NULL.
-// This pointer is eventually cast to bool by the cc_erase API macro.
-static inline void *cc_map_erase(
+static inline void cc_oset_erase_itr(
   void *cntr,
-  void *key,
-  size_t el_size,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
-  cc_hash_fnptr_ty hash,
-  cc_cmpr_fnptr_ty cmpr,
   cc_dtor_fnptr_ty el_dtor,
-  cc_dtor_fnptr_ty key_dtor,
-  cc_free_fnptr_ty free_
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor )
 )
 {
-  if( cc_map_size( cntr ) == 0 )
-    return NULL;
-
-  size_t i = hash( key ) & ( cc_map_hdr( cntr )->cap - 1 );
-  cc_probelen_ty probelen = 1;
-
-  while( probelen <= *cc_map_probelen( cntr, i, el_size, layout ) )
-  {
-    if(
-      probelen == *cc_map_probelen( cntr, i, el_size, layout ) &&
-      cmpr( cc_map_key( cntr, i, el_size, layout ), key ) == 0
-    )
-    {
-      cc_map_erase_itr(
-        cntr,
-        cc_map_el( cntr, i, el_size, layout ),
-        el_size,
-        layout,
-        el_dtor,
-        key_dtor
-      );
-
-      return cc_dummy_true_ptr;
-    }
-
-    i = ( i + 1 ) & ( cc_map_hdr( cntr )->cap - 1 );
-    ++probelen;
-  }
-
-  return NULL;
+  cc_omap_erase_itr( cntr, itr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */ );
 }
 
-// Shrinks map's capacity to the minimum possible without violating the max load factor associated with the key type.
-// If shrinking is necessary, then a complete rehash occurs.
-// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
-// operation was successful and false in the case of allocation failure.
-static inline cc_allocing_fn_result_ty cc_map_shrink(
+static inline CC_ALWAYS_INLINE void *cc_oset_erase(
   void *cntr,
-  size_t el_size,
+  void *key,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
   cc_hash_fnptr_ty hash,
-  double max_load,
-  cc_realloc_fnptr_ty realloc_,
+  cc_cmpr_fnptr_ty cmpr,
+  cc_dtor_fnptr_ty el_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
   cc_free_fnptr_ty free_
 )
 {
-  size_t cap = cc_map_min_cap_for_n_els( cc_map_size( cntr ), max_load );
-
-  if( cap == cc_map_cap( cntr ) ) // Shrink unnecessary.
-    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
-
-  if( cap == 0 ) // Restore placeholder.
-  {
-    if( !cc_map_is_placeholder( cntr ) )
-      free_( cntr );
-
-    return cc_make_allocing_fn_result( (void *)&cc_map_placeholder, cc_dummy_true_ptr );
-  }
-
-  void *new_cntr = cc_map_make_rehash(
+  return cc_omap_erase(
     cntr,
-    cap,
-    el_size,
+    key,
+    0,       // Zero element size.
     layout,
     hash,
-    realloc_
+    cmpr,
+    el_dtor,
+    NULL,    // Only one dtor.
+    free_
   );
-  if( !new_cntr )
-    return cc_make_allocing_fn_result( cntr, NULL );
-
-  if( !cc_map_is_placeholder( cntr ) )
-    free_( cntr );
-
-  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
 }
 
-// Initializes a shallow copy of the source map.
-// The capacity of the copy is the same as the capacity of the source map, unless the source map is empty, in which case
-// the copy is a placeholder.
-// Hence, this function does no rehashing.
-// Returns a the pointer to the copy, or NULL in the case of allocation failure.
-// That return value is cast to bool in the corresponding macro.
-static inline void *cc_map_init_clone(
+static inline void *cc_oset_init_clone(
   void *src,
-  size_t el_size,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
   cc_realloc_fnptr_ty realloc_,
   CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  if( cc_map_size( src ) == 0 ) // Also handles placeholder.
-    return (void *)&cc_map_placeholder;
-
-  cc_map_hdr_ty *new_cntr = (cc_map_hdr_ty*)realloc_(
-    NULL,
-    sizeof( cc_map_hdr_ty ) + CC_BUCKET_SIZE( el_size, layout ) * cc_map_cap( src )
-  );
-  if( !new_cntr )
-    return NULL;
-
-  memcpy( new_cntr, src, sizeof( cc_map_hdr_ty ) + CC_BUCKET_SIZE( el_size, layout ) * cc_map_cap( src ) );
-  return new_cntr;
+  return cc_omap_init_clone( src, /* Zero element size */ 0, layout, realloc_, NULL /* Dummy */ );
 }
 
-// Erases all elements, calling the destructors for the key and element types if necessary, without changing the map's
-// capacity.
-static inline void cc_map_clear(
+static inline void cc_oset_clear(
   void *cntr,
-  size_t el_size,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
   cc_dtor_fnptr_ty el_dtor,
-  cc_dtor_fnptr_ty key_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
   CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  if( cc_map_size( cntr ) == 0 ) // Also handles placeholder map.
-    return;
-
-  for( size_t i = 0; i < cc_map_hdr( cntr )->cap; ++i )
-    if( *cc_map_probelen( cntr, i, el_size, layout ) )
-    {
-      if( key_dtor )
-        key_dtor( cc_map_key( cntr, i, el_size, layout ) );
-
-      if( el_dtor )
-        el_dtor( cc_map_el( cntr, i, el_size, layout ) );
-
-      *cc_map_probelen( cntr, i, el_size, layout ) = 0;
-    }
-
-  cc_map_hdr( cntr )->size = 0;
+  cc_omap_clear( cntr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */, NULL /* Dummy */ );
 }
 
-// Clears the map and frees its memory if is not a placeholder.
-static inline void cc_map_cleanup(
+static inline void cc_oset_cleanup(
   void *cntr,
-  size_t el_size,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout,
   cc_dtor_fnptr_ty el_dtor,
-  cc_dtor_fnptr_ty key_dtor,
+  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
   cc_free_fnptr_ty free_
 )
 {
-  cc_map_clear( cntr, el_size, layout, key_dtor, el_dtor, NULL /* Dummy */ );
+  cc_omap_cleanup( cntr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */, free_ );
+}
 
-  if( !cc_map_is_placeholder( cntr ) )
-    free_( cntr );
+static inline void *cc_oset_r_end( void *cntr )
+{
+  return cc_omap_r_end( cntr );
 }
 
-// For maps, the container handle doubles up as r_end.
-static inline void *cc_map_r_end(
-  void *cntr
+static inline void *cc_oset_end(
+  void *cntr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
 )
 {
-  return cntr;
+  return cc_omap_end( cntr, /* Zero element size */ 0, layout );
 }
 
-// Returns a pointer-iterator to the end of the bucket array.
-static inline void *cc_map_end(
+static inline void *cc_oset_first(
   void *cntr,
-  size_t el_size,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout
 )
 {
-  return cc_map_el( cntr, cc_map_hdr( cntr )->cap, el_size, layout );
+  return cc_omap_first( cntr, /* Zero element size */ 0, layout );
 }
 
-// Returns a pointer-iterator to the first element, or end if the map is empty.
-static inline void *cc_map_first(
+static inline void *cc_oset_last(
   void *cntr,
-  size_t el_size,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout
 )
 {
-  for( size_t i = 0; i < cc_map_hdr( cntr )->cap; ++i )
-    if( *cc_map_probelen( cntr, i, el_size, layout ) )
-      return cc_map_el( cntr, i, el_size, layout );
+  return cc_omap_last( cntr, /* Zero element size */ 0, layout );
+}
 
-  return cc_map_end( cntr, 0 /* Dummy */, layout );
+static inline void *cc_oset_prev(
+  void *cntr,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
+  uint64_t layout
+)
+{
+  return cc_omap_prev( cntr, itr, /* Zero element size */ 0, layout );
 }
 
-// Returns a pointer-iterator to the last element, or r_end if the map is empty.
-static inline void *cc_map_last(
+static inline void *cc_oset_next(
   void *cntr,
-  size_t el_size,
+  void *itr,
+  CC_UNUSED( size_t, el_size ),
   uint64_t layout
 )
 {
-  for( size_t i = cc_map_hdr( cntr )->cap; i-- > 0; )
-    if( *cc_map_probelen( cntr, i, el_size, layout ) )
-      return cc_map_el( cntr, i, el_size, layout );
+  return cc_omap_next( cntr, itr, /* Zero element size */ 0, layout );
+}
 
-  return cc_map_r_end( cntr );
+/*--------------------------------------------------------------------------------------------------------------------*/
+/*                                                     Dense map                                                      */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// A dense map stores its elements and their keys contiguously, in insertion order, in an element array and locates them
+// via a Robin Hood hash table whose buckets hold only indices into that array.
+// Hence, iteration is a linear sweep over packed elements, and its cost does not depend on the table's capacity.
+// Erasing an element moves the last element into its place so that the element array never contains holes.
+// The memory layout is as follows:
+//   - The header.
+//   - The element array, wherein each entry consists of an element followed by its key (see CC_DMAP_ENTRY_SIZE).
+//   - An array containing the hash of each element's key, so that the table can be rebuilt without rehashing keys and
+//     so that the bucket referring to an element can be found from a pointer-iterator alone.
+//   - The bucket array, whose size is always a power of two.
+// The element capacity is the largest number of elements that the bucket array can hold without exceeding the max
+// load factor.
+
+// Bucket.
+// probelen is zero for an empty bucket.
+// frag contains 16 bits of the key's hash so that most mismatching keys can be rejected without accessing the element
+// array.
+typedef struct
+{
+  uint16_t probelen;
+  uint16_t frag;
+  uint32_t index;
+} cc_dmap_bucket_ty;
+
+// Dense map header.
+// max_probelen is an upper bound on the probe length of any bucket, as in the map header.
+// Because probe lengths are stored in 16 bits, insertion fails if max_probelen reaches UINT16_MAX, which could only
+// happen if tens of thousands of keys shared a hash.
+typedef struct
+{
+  alignas( max_align_t )
+  size_t size;
+  size_t cap;
+  size_t bucket_count;
+  size_t max_probelen;
+} cc_dmap_hdr_ty;
+
+// Placeholder for dense map with no allocated memory.
+static const cc_dmap_hdr_ty cc_dmap_placeholder = { 0, 0, 0, 0 };
+
+// Easy header access function for internal use.
+static inline cc_dmap_hdr_ty *cc_dmap_hdr( void *cntr )
+{
+  return (cc_dmap_hdr_ty *)cntr;
 }
 
-static inline void *cc_map_prev(
+static inline size_t cc_dmap_size( void *cntr )
+{
+  return cc_dmap_hdr( cntr )->size;
+}
+
+static inline size_t cc_dmap_cap( void *cntr )
+{
+  return cc_dmap_hdr( cntr )->cap;
+}
+
+static inline bool cc_dmap_is_placeholder( void *cntr )
+{
+  return cc_dmap_hdr( cntr )->bucket_count == 0;
+}
+
+// Functions for locating the arrays inside a dense map with element capacity cap.
+
+static inline size_t cc_dmap_hashes_offset( size_t cap, size_t el_size, uint64_t layout )
+{
+  size_t offset = sizeof( cc_dmap_hdr_ty ) + CC_DMAP_ENTRY_SIZE( el_size, layout ) * cap;
+  return offset + CC_PADDING( offset, alignof( size_t ) );
+}
+
+static inline size_t cc_dmap_buckets_offset( size_t cap, size_t el_size, uint64_t layout )
+{
+  return cc_dmap_hashes_offset( cap, el_size, layout ) + sizeof( size_t ) * cap;
+}
+
+static inline size_t cc_dmap_alloc_size( size_t cap, size_t bucket_count, size_t el_size, uint64_t layout )
+{
+  return cc_dmap_buckets_offset( cap, el_size, layout ) + sizeof( cc_dmap_bucket_ty ) * bucket_count;
+}
+
+static inline CC_ALWAYS_INLINE void *cc_dmap_el( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  return (char *)cntr + sizeof( cc_dmap_hdr_ty ) + CC_DMAP_ENTRY_SIZE( el_size, layout ) * i;
+}
+
+static inline CC_ALWAYS_INLINE void *cc_dmap_key( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  return (char *)cc_dmap_el( cntr, i, el_size, layout ) + CC_KEY_OFFSET( el_size, layout );
+}
+
+static inline CC_ALWAYS_INLINE size_t *cc_dmap_hashes( void *cntr, size_t el_size, uint64_t layout )
+{
+  return (size_t *)( (char *)cntr + cc_dmap_hashes_offset( cc_dmap_cap( cntr ), el_size, layout ) );
+}
+
+static inline CC_ALWAYS_INLINE cc_dmap_bucket_ty *cc_dmap_buckets( void *cntr, size_t el_size, uint64_t layout )
+{
+  return (cc_dmap_bucket_ty *)( (char *)cntr + cc_dmap_buckets_offset( cc_dmap_cap( cntr ), el_size, layout ) );
+}
+
+// Returns the index in the element array of the element pointed to by pointer-iterator itr.
+static inline size_t cc_dmap_itr_index( void *cntr, void *itr, size_t el_size, uint64_t layout )
+{
+  return ( (char *)itr - (char *)cc_dmap_el( cntr, 0, el_size, layout ) ) / CC_DMAP_ENTRY_SIZE( el_size, layout );
+}
+
+// Derives a bucket's hash fragment, remixing the hash as cc_map_meta_frag does.
+static inline uint16_t cc_dmap_frag( size_t hash_val )
+{
+  return (uint16_t)( ( (uint64_t)hash_val * 0x9E3779B97F4A7C15ull ) >> 48 );
+}
+
+// Returns the index of the bucket referring to the element with the specified key, whose hash is hash_val, or the
+// bucket count if no such element exists.
+static inline CC_ALWAYS_INLINE size_t cc_dmap_find(
   void *cntr,
-  void *itr,
+  void *key,
+  size_t hash_val,
   size_t el_size,
-  uint64_t layout
+  uint64_t layout,
+  cc_cmpr_fnptr_ty cmpr
 )
 {
-  size_t j = ( (char *)itr - (char *)cc_map_el( cntr, 0, el_size, layout ) ) / CC_BUCKET_SIZE( el_size, layout );
+  cc_dmap_hdr_ty *hdr = cc_dmap_hdr( cntr );
+  cc_dmap_bucket_ty *buckets = cc_dmap_buckets( cntr, el_size, layout );
+  size_t mask = hdr->bucket_count - 1;
+  uint16_t frag = cc_dmap_frag( hash_val );
+
+  size_t i = hash_val & mask;
+  for( size_t probelen = 1; probelen <= hdr->max_probelen; ++probelen, i = ( i + 1 ) & mask )
+  {
+    if( buckets[ i ].probelen < probelen )
+      break;
+
+    if(
+      buckets[ i ].probelen == probelen &&
+      buckets[ i ].frag == frag &&
+      cmpr( key, cc_dmap_key( cntr, buckets[ i ].index, el_size, layout ) ) == 0
+    )
+      return i;
+  }
+
+  return hdr->bucket_count;
+}
+
+// Returns the index of the bucket referring to the element at index i in the element array.
+static inline size_t cc_dmap_bucket_for( void *cntr, size_t i, size_t el_size, uint64_t layout )
+{
+  cc_dmap_bucket_ty *buckets = cc_dmap_buckets( cntr, el_size, layout );
+  size_t mask = cc_dmap_hdr( cntr )->bucket_count - 1;
+
+  size_t bucket = cc_dmap_hashes( cntr, el_size, layout )[ i ] & mask;
+  while( buckets[ bucket ].probelen == 0 || buckets[ bucket ].index != i )
+    bucket = ( bucket + 1 ) & mask;
+
+  return bucket;
+}
+
+// Places a bucket referring to the element at index i in the element array, whose key's hash is hash_val, and then
+// moves any displaced buckets further along the probe sequence in Robin Hood fashion.
+// Only the small buckets move, never the elements themselves.
+static inline void cc_dmap_place( void *cntr, size_t i, size_t hash_val, size_t el_size, uint64_t layout )
+{
+  cc_dmap_hdr_ty *hdr = cc_dmap_hdr( cntr );
+  cc_dmap_bucket_ty *buckets = cc_dmap_buckets( cntr, el_size, layout );
+  size_t mask = hdr->bucket_count - 1;
 
+  cc_dmap_bucket_ty bucket = { 1, cc_dmap_frag( hash_val ), (uint32_t)i };
+  size_t home = hash_val & mask;
   while( true )
   {
-    if( j == 0 )
-      return cc_map_r_end( cntr );
+    if( buckets[ home ].probelen < bucket.probelen )
+    {
+      if( bucket.probelen > hdr->max_probelen )
+        hdr->max_probelen = bucket.probelen;
+
+      cc_dmap_bucket_ty displaced = buckets[ home ];
+      buckets[ home ] = bucket;
+      if( displaced.probelen == 0 )
+        return;
+
+      bucket = displaced;
+    }
 
-    --j;
-    if( *cc_map_probelen( cntr, j, el_size, layout ) )
-      return cc_map_el( cntr, j, el_size, layout );
+    ++bucket.probelen;
+    home = ( home + 1 ) & mask;
   }
 }
 
-static inline void *cc_map_next(
-  void *cntr,
-  void *itr,
-  size_t el_size,
-  uint64_t layout
-)
+// Empties the bucket at index i, shifting subsequent buckets back as in cc_map_erase_itr.
+static inline void cc_dmap_remove_bucket( void *cntr, size_t i, size_t el_size, uint64_t layout )
 {
-  size_t j = ( (char *)itr - (char *)cc_map_el( cntr, 0, el_size, layout ) ) / CC_BUCKET_SIZE( el_size, layout ) + 1;
+  cc_dmap_bucket_ty *buckets = cc_dmap_buckets( cntr, el_size, layout );
+  size_t mask = cc_dmap_hdr( cntr )->bucket_count - 1;
 
-  while( j < cc_map_hdr( cntr )->cap && !*cc_map_probelen( cntr, j, el_size, layout ) )
-    ++j;
+  size_t next;
+  while( buckets[ next = ( i + 1 ) & mask ].probelen > 1 )
+  {
+    buckets[ i ] = buckets[ next ];
+    --buckets[ i ].probelen;
+    i = next;
+  }
 
-  return cc_map_el( cntr, j, el_size, layout );
+  buckets[ i ].probelen = 0;
 }
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/*                                                        Set                                                         */
-/*--------------------------------------------------------------------------------------------------------------------*/
+// Rebuilds the bucket array from the stored hashes.
+static inline void cc_dmap_rebuild( void *cntr, size_t el_size, uint64_t layout )
+{
+  cc_dmap_hdr_ty *hdr = cc_dmap_hdr( cntr );
+  memset( cc_dmap_buckets( cntr, el_size, layout ), 0, sizeof( cc_dmap_bucket_ty ) * hdr->bucket_count );
+  hdr->max_probelen = 0;
 
-// A set is implemented as a map where the key and element are combined into one space in memory.
-// Hence, it reuses the functions for map, except:
-//   - The key offset inside the bucket is zero.
-//     This is handled at the API-macro level via the cc_layout function and associated macros.
-//   - The element size passed into map functions is zero in order to avoid double-memcpying.
+  size_t *hashes = cc_dmap_hashes( cntr, el_size, layout );
+  for( size_t i = 0; i < hdr->size; ++i )
+    cc_dmap_place( cntr, i, hashes[ i ], el_size, layout );
+}
 
-static inline size_t cc_set_size( void *cntr )
+// Returns the element capacity for the specified bucket count.
+// Indices must fit into a bucket's uint32_t.
+static inline size_t cc_dmap_cap_for_bucket_count( size_t bucket_count, double max_load )
 {
-  return cc_map_size( cntr );
+  size_t cap = (size_t)( bucket_count * max_load );
+  return cap > UINT32_MAX ? UINT32_MAX : cap;
 }
 
-static inline size_t cc_set_cap( void *cntr )
+// Returns true if a dense map with element capacity cap and the specified bucket count would be too large for its
+// allocation size to be represented by a size_t.
+static inline bool cc_dmap_alloc_size_overflows( size_t cap, size_t bucket_count, size_t el_size, uint64_t layout )
 {
-  return cc_map_cap( cntr );
+  return
+    cap > SIZE_MAX / 4 / ( CC_DMAP_ENTRY_SIZE( el_size, layout ) + sizeof( size_t ) ) ||
+    bucket_count > SIZE_MAX / 4 / sizeof( cc_dmap_bucket_ty );
 }
 
-static inline cc_allocing_fn_result_ty cc_set_reserve(
+// Ensures that the capacity is large enough to support n elements without reallocation.
+// The element array keeps its place at the start of the allocation, so realloc preserves it, and only the hash array
+// needs to be moved and the bucket array rebuilt.
+// Returns a cc_allocing_fn_result_ty containing the new handle and a pointer that evaluates to true if the operation
+// was successful or false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_dmap_reserve(
   void *cntr,
   size_t n,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
+  uint64_t layout,
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
+  double max_load,
+  cc_realloc_fnptr_ty realloc_,
+  CC_UNUSED( cc_free_fnptr_ty, free_ )
+)
+{
+  if( n <= cc_dmap_cap( cntr ) )
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  if( n > UINT32_MAX )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  size_t bucket_count = cc_map_min_cap_for_n_els( n, max_load );
+  size_t cap = cc_dmap_cap_for_bucket_count( bucket_count, max_load );
+  if( cc_dmap_alloc_size_overflows( cap, bucket_count, el_size, layout ) )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  bool is_placeholder = cc_dmap_is_placeholder( cntr );
+  size_t old_cap = cc_dmap_cap( cntr );
+
+  cc_dmap_hdr_ty *new_cntr = (cc_dmap_hdr_ty *)realloc_(
+    is_placeholder ? NULL : cntr,
+    cc_dmap_alloc_size( cap, bucket_count, el_size, layout )
+  );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  if( is_placeholder )
+    *new_cntr = cc_dmap_placeholder;
+
+  memmove(
+    (char *)new_cntr + cc_dmap_hashes_offset( cap, el_size, layout ),
+    (char *)new_cntr + cc_dmap_hashes_offset( old_cap, el_size, layout ),
+    sizeof( size_t ) * new_cntr->size
+  );
+
+  new_cntr->cap = cap;
+  new_cntr->bucket_count = bucket_count;
+  cc_dmap_rebuild( new_cntr, el_size, layout );
+
+  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
+}
+
+// Inserts an element.
+// If replace is true, then el replaces any existing element with the same key.
+// If el is NULL, the inserted or replacing element is left uninitialized.
+// The new element is appended to the element array.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer-iterator to the newly inserted
+// element (or to the existing element with the same key if replace is false).
+// If the underlying storage needed to be expanded and an allocation failure occurred, or if the key's probe length
+// could not be represented, the latter pointer will be NULL.
+static inline CC_ALWAYS_INLINE cc_allocing_fn_result_ty cc_dmap_insert(
+  void *cntr,
+  void *el,
+  void *key,
+  bool replace,
+  size_t el_size,
   uint64_t layout,
   cc_hash_fnptr_ty hash,
+  cc_cmpr_fnptr_ty cmpr,
   double max_load,
+  CC_UNUSED( size_t, max_probelen ),
+  CC_UNUSED( const cc_vec_growth_ty *, growth ),
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
   cc_realloc_fnptr_ty realloc_,
   cc_free_fnptr_ty free_
 )
 {
-  return cc_map_reserve( cntr, n, 0 /* Zero element size */, layout, hash, max_load, realloc_, free_ );
+  size_t hash_val = hash( key );
+
+  if( cc_dmap_size( cntr ) )
+  {
+    size_t i = cc_dmap_find( cntr, key, hash_val, el_size, layout, cmpr );
+    if( i != cc_dmap_hdr( cntr )->bucket_count )
+    {
+      size_t index = cc_dmap_buckets( cntr, el_size, layout )[ i ].index;
+      if( replace )
+      {
+        if( key_dtor )
+          key_dtor( cc_dmap_key( cntr, index, el_size, layout ) );
+
+        if( el_dtor )
+          el_dtor( cc_dmap_el( cntr, index, el_size, layout ) );
+
+        memcpy( cc_dmap_key( cntr, index, el_size, layout ), key, CC_KEY_SIZE( layout ) );
+        if( el )
+          memcpy( cc_dmap_el( cntr, index, el_size, layout ), el, el_size );
+      }
+
+      return cc_make_allocing_fn_result( cntr, cc_dmap_el( cntr, index, el_size, layout ) );
+    }
+  }
+
+  if( cc_dmap_size( cntr ) + 1 > cc_dmap_cap( cntr ) )
+  {
+    cc_allocing_fn_result_ty result = cc_dmap_reserve(
+      cntr,
+      cc_dmap_size( cntr ) + 1,
+      el_size,
+      layout,
+      hash,
+      max_load,
+      realloc_,
+      free_
+    );
+
+    if( !result.other_ptr )
+      return result;
+
+    cntr = result.new_cntr;
+  }
+
+  if( cc_dmap_hdr( cntr )->max_probelen >= UINT16_MAX )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  size_t index = cc_dmap_hdr( cntr )->size++;
+  if( el )
+    memcpy( cc_dmap_el( cntr, index, el_size, layout ), el, el_size );
+
+  memcpy( cc_dmap_key( cntr, index, el_size, layout ), key, CC_KEY_SIZE( layout ) );
+  cc_dmap_hashes( cntr, el_size, layout )[ index ] = hash_val;
+  cc_dmap_place( cntr, index, hash_val, el_size, layout );
+
+  return cc_make_allocing_fn_result( cntr, cc_dmap_el( cntr, index, el_size, layout ) );
 }
 
-static inline cc_allocing_fn_result_ty cc_set_insert(
+// Inserts an uninitialized element for the caller to construct in place if no element with the specified key exists.
+// *inserted is set to whether the element was inserted, which is determined by comparing the dense map's size before
+// and after the insertion.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer-iterator to the new or existing
+// element, or NULL in the case of memory allocation failure.
+static inline cc_allocing_fn_result_ty cc_dmap_get_or_insert_uninit(
   void *cntr,
   void *key,
-  bool replace,
+  bool *inserted,
+  size_t el_size,
   uint64_t layout,
   cc_hash_fnptr_ty hash,
   cc_cmpr_fnptr_ty cmpr,
   double max_load,
+  size_t max_probelen,
   cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
   cc_realloc_fnptr_ty realloc_,
   cc_free_fnptr_ty free_
 )
 {
-  return cc_map_insert(
+  size_t size = cc_dmap_size( cntr );
+
+  cc_allocing_fn_result_ty result = cc_dmap_insert(
     cntr,
-    cntr,     // Dummy pointer for element as memcpying to a NULL pointer is undefined behavior even when size is zero.
+    NULL,
     key,
-    replace,
-    0,        // Zero element size.
+    false,
+    el_size,
     layout,
     hash,
     cmpr,
     max_load,
+    max_probelen,
+    NULL, // Dummy.
     el_dtor,
-    NULL,     // Only one dtor.
+    key_dtor,
     realloc_,
     free_
   );
+
+  *inserted = result.other_ptr && cc_dmap_size( result.new_cntr ) != size;
+  return result;
 }
 
-static inline void *cc_set_get(
+// Returns a pointer-iterator to the element with the specified key, or NULL if no such element exists.
+static inline CC_ALWAYS_INLINE void *cc_dmap_get(
   void *cntr,
   void *key,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
   cc_hash_fnptr_ty hash,
   cc_cmpr_fnptr_ty cmpr
 )
 {
-  return cc_map_get( cntr, key, 0 /* Dummy */, layout, hash, cmpr );
+  if( cc_dmap_size( cntr ) == 0 )
+    return NULL;
+
+  size_t i = cc_dmap_find( cntr, key, hash( key ), el_size, layout, cmpr );
+  if( i == cc_dmap_hdr( cntr )->bucket_count )
+    return NULL;
+
+  return cc_dmap_el( cntr, cc_dmap_buckets( cntr, el_size, layout )[ i ].index, el_size, layout );
+}
+
+// Returns a pointer to the key for the element pointed to by the specified pointer-iterator.
+static inline void *cc_dmap_key_for(
+  CC_UNUSED( void *, cntr ),
+  void *itr,
+  size_t el_size,
+  uint64_t layout
+)
+{
+  return (char *)itr + CC_KEY_OFFSET( el_size, layout );
 }
 
-static inline void cc_set_erase_itr(
+// Erases the element pointed to by pointer-iterator itr.
+// The last element is moved into the vacated entry, so after this call itr points to the element that was last, or to
+// end if the erased element was itself the last element.
+static inline void cc_dmap_erase_itr(
   void *cntr,
   void *itr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
   cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor )
+  cc_dtor_fnptr_ty key_dtor
 )
 {
-  cc_map_erase_itr( cntr, itr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */ );
+  size_t i = cc_dmap_itr_index( cntr, itr, el_size, layout );
+  cc_dmap_remove_bucket( cntr, cc_dmap_bucket_for( cntr, i, el_size, layout ), el_size, layout );
+
+  if( key_dtor )
+    key_dtor( cc_dmap_key( cntr, i, el_size, layout ) );
+
+  if( el_dtor )
+    el_dtor( itr );
+
+  size_t last = --cc_dmap_hdr( cntr )->size;
+  if( i != last )
+  {
+    cc_dmap_buckets( cntr, el_size, layout )[ cc_dmap_bucket_for( cntr, last, el_size, layout ) ].index = (uint32_t)i;
+    memcpy( itr, cc_dmap_el( cntr, last, el_size, layout ), CC_DMAP_ENTRY_SIZE( el_size, layout ) );
+
+    size_t *hashes = cc_dmap_hashes( cntr, el_size, layout );
+    hashes[ i ] = hashes[ last ];
+  }
 }
 
-static inline void *cc_set_erase(
+// Erases the element with the specified key, if it exists.
+// Returns a pointer that evaluates to true if an element was erased, or else is NULL.
+// This pointer is eventually cast to bool by the cc_erase API macro.
+static inline CC_ALWAYS_INLINE void *cc_dmap_erase(
   void *cntr,
   void *key,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
   cc_hash_fnptr_ty hash,
   cc_cmpr_fnptr_ty cmpr,
   cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_dtor_fnptr_ty key_dtor,
   CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  return cc_map_erase(
-    cntr,
-    key,
-    0,       // Zero element size.
-    layout,
-    hash,
-    cmpr,
-    el_dtor,
-    NULL,    // Only one dtor.
-    NULL     // Dummy.
-  );
+  void *itr = cc_dmap_get( cntr, key, el_size, layout, hash, cmpr );
+  if( !itr )
+    return NULL;
+
+  cc_dmap_erase_itr( cntr, itr, el_size, layout, el_dtor, key_dtor );
+  return cc_dummy_true_ptr;
 }
 
-static inline cc_allocing_fn_result_ty cc_set_shrink(
+// Shrinks the dense map's capacity to the minimum possible without violating the max load factor associated with the
+// key type.
+// If shrinking is necessary, then a complete rebuild of the bucket array occurs.
+// Returns a cc_allocing_fn_result_ty containing the new container handle and a pointer that evaluates to true if the
+// operation was successful and false in the case of allocation failure.
+static inline cc_allocing_fn_result_ty cc_dmap_shrink(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
-  cc_hash_fnptr_ty hash,
+  CC_UNUSED( cc_hash_fnptr_ty, hash ),
   double max_load,
   cc_realloc_fnptr_ty realloc_,
   cc_free_fnptr_ty free_
 )
 {
-  return cc_map_shrink( cntr, 0 /* Zero element size */, layout, hash, max_load, realloc_, free_ );
+  size_t bucket_count = cc_map_min_cap_for_n_els( cc_dmap_size( cntr ), max_load );
+  if( bucket_count == cc_dmap_hdr( cntr )->bucket_count ) // Shrink unnecessary.
+    return cc_make_allocing_fn_result( cntr, cc_dummy_true_ptr );
+
+  if( bucket_count == 0 ) // Restore placeholder.
+  {
+    free_( cntr );
+    return cc_make_allocing_fn_result( (void *)&cc_dmap_placeholder, cc_dummy_true_ptr );
+  }
+
+  size_t cap = cc_dmap_cap_for_bucket_count( bucket_count, max_load );
+  size_t alloc_size = cc_dmap_alloc_size( cap, bucket_count, el_size, layout );
+  cc_dmap_hdr_ty *new_cntr = (cc_dmap_hdr_ty *)realloc_( NULL, alloc_size );
+  if( !new_cntr )
+    return cc_make_allocing_fn_result( cntr, NULL );
+
+  size_t size = cc_dmap_size( cntr );
+  memcpy( new_cntr, cntr, sizeof( cc_dmap_hdr_ty ) + CC_DMAP_ENTRY_SIZE( el_size, layout ) * size );
+  new_cntr->cap = cap;
+  new_cntr->bucket_count = bucket_count;
+  memcpy(
+    cc_dmap_hashes( new_cntr, el_size, layout ),
+    cc_dmap_hashes( cntr, el_size, layout ),
+    sizeof( size_t ) * size
+  );
+  cc_dmap_rebuild( new_cntr, el_size, layout );
+
+  free_( cntr );
+  return cc_make_allocing_fn_result( new_cntr, cc_dummy_true_ptr );
 }
 
-static inline void *cc_set_init_clone(
+// Initializes a shallow copy of the source dense map.
+// Returns a the pointer to the copy, or NULL in the case of allocation failure.
+// That return value is cast to bool in the corresponding macro.
+static inline void *cc_dmap_init_clone(
   void *src,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
   cc_realloc_fnptr_ty realloc_,
   CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  return cc_map_init_clone( src, /* Zero element size */ 0, layout, realloc_, NULL /* Dummy */ );
+  if( cc_dmap_size( src ) == 0 ) // Also handles placeholder.
+    return (void *)&cc_dmap_placeholder;
+
+  size_t alloc_size = cc_dmap_alloc_size( cc_dmap_cap( src ), cc_dmap_hdr( src )->bucket_count, el_size, layout );
+  cc_dmap_hdr_ty *new_cntr = (cc_dmap_hdr_ty *)realloc_( NULL, alloc_size );
+  if( !new_cntr )
+    return NULL;
+
+  memcpy( new_cntr, src, alloc_size );
+  return new_cntr;
 }
 
-static inline void cc_set_clear(
+// Erases all elements, calling the destructors for the key and element types if necessary, without changing the
+// capacity.
+static inline void cc_dmap_clear(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
   cc_dtor_fnptr_ty el_dtor,
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
+  cc_dtor_fnptr_ty key_dtor,
   CC_UNUSED( cc_free_fnptr_ty, free_ )
 )
 {
-  cc_map_clear( cntr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */, NULL /* Dummy */ );
+  if( cc_dmap_size( cntr ) == 0 ) // Also handles placeholder.
+    return;
+
+  for( size_t i = 0; i < cc_dmap_size( cntr ); ++i )
+  {
+    if( key_dtor )
+      key_dtor( cc_dmap_key( cntr, i, el_size, layout ) );
+
+    if( el_dtor )
+      el_dtor( cc_dmap_el( cntr, i, el_size, layout ) );
+  }
+
+  cc_dmap_hdr( cntr )->size = 0;
+  cc_dmap_rebuild( cntr, el_size, layout );
 }
 
-static inline void cc_set_cleanup(
+// Clears the dense map and frees its memory if is not a placeholder.
+static inline void cc_dmap_cleanup(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout,
-  void ( *el_dtor )( void * ),
-  CC_UNUSED( cc_dtor_fnptr_ty, key_dtor ),
-  void ( *free_ )( void * ))
+  cc_dtor_fnptr_ty el_dtor,
+  cc_dtor_fnptr_ty key_dtor,
+  cc_free_fnptr_ty free_
+)
 {
-  cc_map_cleanup( cntr, 0 /* Zero element size */, layout, el_dtor, NULL /* Only one dtor */, free_ );
+  cc_dmap_clear( cntr, el_size, layout, el_dtor, key_dtor, free_ );
+
+  if( !cc_dmap_is_placeholder( cntr ) )
+    free_( cntr );
 }
 
-static inline void *cc_set_r_end( void *cntr )
+// For dense maps, the container handle doubles up as r_end.
+static inline void *cc_dmap_r_end(
+  void *cntr
+)
 {
-  return cc_map_r_end( cntr );
+  return cntr;
 }
 
-static inline void *cc_set_end(
+// Returns a pointer-iterator to the entry after the last element.
+static inline void *cc_dmap_end(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout
 )
 {
-  return cc_map_end( cntr, /* Zero element size */ 0, layout );
+  return cc_dmap_el( cntr, cc_dmap_size( cntr ), el_size, layout );
 }
 
-static inline void *cc_set_first(
+// Returns a pointer-iterator to the first element, or end if the dense map is empty.
+static inline void *cc_dmap_first(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout
 )
 {
-  return cc_map_first( cntr, /* Zero element size */ 0, layout );
+  return cc_dmap_el( cntr, 0, el_size, layout );
 }
 
-static inline void *cc_set_last(
+// Returns a pointer-iterator to the last element, or r_end if the dense map is empty.
+static inline void *cc_dmap_last(
   void *cntr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout
 )
 {
-  return cc_map_last( cntr, /* Zero element size */ 0, layout );
+  if( cc_dmap_size( cntr ) == 0 )
+    return cc_dmap_r_end( cntr );
+
+  return cc_dmap_el( cntr, cc_dmap_size( cntr ) - 1, el_size, layout );
 }
 
-static inline void *cc_set_prev(
+static inline void *cc_dmap_prev(
   void *cntr,
   void *itr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout
 )
 {
-  return cc_map_prev( cntr, itr, /* Zero element size */ 0, layout );
+  if( itr == cc_dmap_first( cntr, el_size, layout ) )
+    return cc_dmap_r_end( cntr );
+
+  return (char *)itr - CC_DMAP_ENTRY_SIZE( el_size, layout );
 }
 
-static inline void *cc_set_next(
+static inline void *cc_dmap_next(
   void *cntr,
   void *itr,
-  CC_UNUSED( size_t, el_size ),
+  size_t el_size,
   uint64_t layout
 )
 {
-  return cc_map_next( cntr, itr, /* Zero element size */ 0, layout );
+  if( itr == cc_dmap_r_end( cntr ) )
+    return cc_dmap_first( cntr, el_size, layout );
+
+  return (char *)itr + CC_DMAP_ENTRY_SIZE( el_size, layout );
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -2848,13 +8802,19 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                                \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                   \
   ),                                                                                   \
   *(cntr) = (                                                                          \
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ? (CC_TYPEOF_XP( *(cntr) ))&cc_vec_placeholder  : \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ? (CC_TYPEOF_XP( *(cntr) ))&cc_list_placeholder : \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ? (CC_TYPEOF_XP( *(cntr) ))&cc_map_placeholder  : \
-                          /* CC_SET */ (CC_TYPEOF_XP( *(cntr) ))&cc_map_placeholder    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ? (CC_TYPEOF_XP( *(cntr) ))&cc_map_placeholder  : \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ? (CC_TYPEOF_XP( *(cntr) ))&cc_omap_placeholder : \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ? (CC_TYPEOF_XP( *(cntr) ))&cc_omap_placeholder : \
+                         /* CC_DMAP */ (CC_TYPEOF_XP( *(cntr) ))&cc_dmap_placeholder   \
   ),                                                                                   \
   (void)0                                                                              \
 )                                                                                      \
@@ -2866,14 +8826,20 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||               \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||               \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||               \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                   \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||               \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||               \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||               \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                  \
   ),                                                  \
   /* Function select */                               \
   (                                                   \
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_size  : \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_size : \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_size  : \
-                          /* CC_SET */ cc_set_size    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_size  : \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_size : \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_size : \
+                         /* CC_DMAP */ cc_dmap_size   \
   )                                                   \
   /* Function args */                                 \
   (                                                   \
@@ -2885,15 +8851,17 @@ static inline void *cc_set_next(
 (                                                   \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),           \
   CC_STATIC_ASSERT(                                 \
-    CC_CNTR_ID( *(cntr) ) == CC_VEC ||              \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP ||              \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                 \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||             \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||             \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||             \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                \
   ),                                                \
   /* Function select */                             \
   (                                                 \
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_cap : \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_cap : \
-                          /* CC_SET */ cc_set_cap   \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_cap : \
+                         /* CC_DMAP */ cc_dmap_cap  \
   )                                                 \
   /* Function args */                               \
   (                                                 \
@@ -2907,24 +8875,219 @@ static inline void *cc_set_next(
   CC_STATIC_ASSERT(                                                                          \
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                                      \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                      \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                         \
+  ),                                                                                         \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
+    *(cntr),                                                                                 \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_reserve :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_reserve :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_reserve :                                    \
+                           /* CC_DMAP */ cc_dmap_reserve                                     \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
+      *(cntr),                                                                               \
+      n,                                                                                     \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      CC_LAYOUT( *(cntr) ),                                                                  \
+      CC_KEY_HASH( *(cntr) ),                                                                \
+      CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
+  ),                                                                                         \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                            \
+
+#define cc_insert( ... ) CC_SELECT_ON_NUM_ARGS( cc_insert, __VA_ARGS__ )
+
+#define cc_insert_2( cntr, key )                                                             \
+(                                                                                            \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_SET ||                                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET                                                         \
+  ),                                                                                         \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
+    *(cntr),                                                                                 \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_insert  :                                    \
+                           /* CC_OSET */ cc_oset_insert                                      \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
+      *(cntr),                                                                               \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
+      true,                                                                                  \
+      CC_LAYOUT( *(cntr) ),                                                                  \
+      CC_KEY_HASH( *(cntr) ),                                                                \
+      CC_KEY_CMPR( *(cntr) ),                                                                \
+      CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
+      CC_EL_DTOR( *(cntr) ),                                                                 \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
+  ),                                                                                         \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                            \
+
+#define cc_insert_3( cntr, key, el )                                                         \
+(                                                                                            \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                         \
+  ),                                                                                         \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
+    *(cntr),                                                                                 \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_insert  :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_insert :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_insert  :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_insert :                                    \
+                           /* CC_DMAP */ cc_dmap_insert                                      \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
+      *(cntr),                                                                               \
+      &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                       \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
+      true,                                                                                  \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      CC_LAYOUT( *(cntr) ),                                                                  \
+      CC_KEY_HASH( *(cntr) ),                                                                \
+      CC_KEY_CMPR( *(cntr) ),                                                                \
+      CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_EL_DTOR( *(cntr) ),                                                                 \
+      CC_KEY_DTOR( *(cntr) ),                                                                \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
+  ),                                                                                         \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                            \
+
+#define cc_insert_uninit( cntr, key )                                                        \
+(                                                                                            \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                         \
+  ),                                                                                         \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
+    *(cntr),                                                                                 \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_insert  :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_insert :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_insert  :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_insert :                                    \
+                           /* CC_DMAP */ cc_dmap_insert                                      \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
+      *(cntr),                                                                               \
+      NULL,                                                                                  \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
+      true,                                                                                  \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      CC_LAYOUT( *(cntr) ),                                                                  \
+      CC_KEY_HASH( *(cntr) ),                                                                \
+      CC_KEY_CMPR( *(cntr) ),                                                                \
+      CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_EL_DTOR( *(cntr) ),                                                                 \
+      CC_KEY_DTOR( *(cntr) ),                                                                \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
   ),                                                                                         \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                            \
+
+#define cc_insert_with_hash( ... ) CC_SELECT_ON_NUM_ARGS( cc_insert_with_hash, __VA_ARGS__ )
+
+#define cc_insert_with_hash_3( cntr, key, hash_val )                                        \
+(                                                                                           \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                   \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_SET ),                                      \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                      \
+    *(cntr),                                                                                \
+    cc_set_insert_hashed(                                                                   \
+      *(cntr),                                                                              \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                    \
+      (hash_val),                                                                           \
+      true,                                                                                 \
+      CC_LAYOUT( *(cntr) ),                                                                 \
+      CC_KEY_HASH( *(cntr) ),                                                               \
+      CC_KEY_CMPR( *(cntr) ),                                                               \
+      CC_KEY_LOAD( *(cntr) ),                                                               \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                       \
+      CC_EL_DTOR( *(cntr) ),                                                                \
+      CC_REALLOC_FN,                                                                        \
+      CC_FREE_FN                                                                            \
+    )                                                                                       \
+  ),                                                                                        \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )\
+)                                                                                           \
+                                                                                            \
+
+#define cc_insert_with_hash_4( cntr, key, el, hash_val )                                    \
+(                                                                                           \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                   \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_MAP ),                                      \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                      \
+    *(cntr),                                                                                \
+    cc_map_insert_hashed(                                                                   \
+      *(cntr),                                                                              \
+      &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                      \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                    \
+      (hash_val),                                                                           \
+      true,                                                                                 \
+      CC_EL_SIZE( *(cntr) ),                                                                \
+      CC_LAYOUT( *(cntr) ),                                                                 \
+      CC_KEY_HASH( *(cntr) ),                                                               \
+      CC_KEY_CMPR( *(cntr) ),                                                               \
+      CC_KEY_LOAD( *(cntr) ),                                                               \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                       \
+      CC_EL_DTOR( *(cntr) ),                                                                \
+      CC_KEY_DTOR( *(cntr) ),                                                               \
+      CC_REALLOC_FN,                                                                        \
+      CC_FREE_FN                                                                            \
+    )                                                                                       \
+  ),                                                                                        \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )\
+)                                                                                           \
+                                                                                            \
+
+#define cc_insert_n( cntr, index, els, n )                                                   \
+(                                                                                            \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                       \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    /* Function select */                                                                    \
-    (                                                                                        \
-      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_reserve :                                    \
-      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_reserve :                                    \
-                            /* CC_SET */ cc_set_reserve                                      \
-    )                                                                                        \
-    /* Function args */                                                                      \
-    (                                                                                        \
+    cc_vec_insert_n(                                                                         \
       *(cntr),                                                                               \
-      n,                                                                                     \
+      (index),                                                                               \
+      (els),                                                                                 \
+      (n),                                                                                   \
       CC_EL_SIZE( *(cntr) ),                                                                 \
-      CC_LAYOUT( *(cntr) ),                                                                  \
-      CC_KEY_HASH( *(cntr) ),                                                                \
-      CC_KEY_LOAD( *(cntr) ),                                                                \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
       CC_REALLOC_FN,                                                                         \
       CC_FREE_FN                                                                             \
     )                                                                                        \
@@ -2932,22 +9095,32 @@ static inline void *cc_set_next(
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                                            \
 
-#define cc_insert( ... ) CC_SELECT_ON_NUM_ARGS( cc_insert, __VA_ARGS__ )
+#define cc_insert_keys( ... ) CC_SELECT_ON_NUM_ARGS( cc_insert_keys, __VA_ARGS__ )
 
-#define cc_insert_2( cntr, key )                                                             \
+#define cc_insert_keys_3( cntr, keys, n )                                                    \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
-  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_SET ),                                       \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_SET ||                                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET                                                         \
+  ),                                                                                         \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    cc_set_insert(                                                                           \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_insert_keys  :                               \
+                           /* CC_OSET */ cc_oset_insert_keys                                 \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
       *(cntr),                                                                               \
-      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
-      true,                                                                                  \
+      (keys),                                                                                \
+      (n),                                                                                   \
       CC_LAYOUT( *(cntr) ),                                                                  \
       CC_KEY_HASH( *(cntr) ),                                                                \
       CC_KEY_CMPR( *(cntr) ),                                                                \
       CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
       CC_EL_DTOR( *(cntr) ),                                                                 \
       CC_REALLOC_FN,                                                                         \
       CC_FREE_FN                                                                             \
@@ -2956,33 +9129,32 @@ static inline void *cc_set_next(
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                                            \
 
-#define cc_insert_3( cntr, key, el )                                                         \
+#define cc_insert_keys_4( cntr, keys, els, n )                                               \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
   CC_STATIC_ASSERT(                                                                          \
-    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                                      \
-    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                                      \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP                                                         \
   ),                                                                                         \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
     /* Function select */                                                                    \
     (                                                                                        \
-      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_insert  :                                    \
-      CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_insert :                                    \
-                            /* CC_MAP */ cc_map_insert                                       \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_insert_keys  :                               \
+                           /* CC_OMAP */ cc_omap_insert_keys                                 \
     )                                                                                        \
     /* Function args */                                                                      \
     (                                                                                        \
       *(cntr),                                                                               \
-      &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                       \
-      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
-      true,                                                                                  \
+      (keys),                                                                                \
+      (els),                                                                                 \
+      (n),                                                                                   \
       CC_EL_SIZE( *(cntr) ),                                                                 \
       CC_LAYOUT( *(cntr) ),                                                                  \
       CC_KEY_HASH( *(cntr) ),                                                                \
       CC_KEY_CMPR( *(cntr) ),                                                                \
       CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
       CC_EL_DTOR( *(cntr) ),                                                                 \
       CC_KEY_DTOR( *(cntr) ),                                                                \
       CC_REALLOC_FN,                                                                         \
@@ -2992,18 +9164,34 @@ static inline void *cc_set_next(
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                                            \
 
-#define cc_insert_n( cntr, index, els, n )                                                   \
+#define cc_push( cntr, el )                                                                  \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
-  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                       \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_LIST                                                         \
+  ),                                                                                         \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    cc_vec_insert_n( *(cntr), (index), (els), (n), CC_EL_SIZE( *(cntr) ), CC_REALLOC_FN )    \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_VEC  ?  cc_vec_push  :                                     \
+                            /* CC_LIST */ cc_list_push                                       \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
+      *(cntr),                                                                               \
+      &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                       \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
   ),                                                                                         \
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                                            \
 
-#define cc_push( cntr, el )                                                                  \
+#define cc_push_uninit( cntr )                                                               \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
   CC_STATIC_ASSERT(                                                                          \
@@ -3020,9 +9208,11 @@ static inline void *cc_set_next(
     /* Function args */                                                                      \
     (                                                                                        \
       *(cntr),                                                                               \
-      &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                       \
+      NULL,                                                                                  \
       CC_EL_SIZE( *(cntr) ),                                                                 \
-      CC_REALLOC_FN                                                                          \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
     )                                                                                        \
   ),                                                                                         \
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
@@ -3034,7 +9224,15 @@ static inline void *cc_set_next(
   CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                       \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    cc_vec_push_n( *(cntr), (els), (n), CC_EL_SIZE( *(cntr) ), CC_REALLOC_FN )               \
+    cc_vec_push_n(                                                                           \
+      *(cntr),                                                                               \
+      (els),                                                                                 \
+      (n),                                                                                   \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
   ),                                                                                         \
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                                            \
@@ -3044,10 +9242,19 @@ static inline void *cc_set_next(
 #define cc_get_or_insert_2( cntr, key )                                                      \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
-  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_SET ),                                       \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_SET ||                                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET                                                         \
+  ),                                                                                         \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    cc_set_insert(                                                                           \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_insert  :                                    \
+                           /* CC_OSET */ cc_oset_insert                                      \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
       *(cntr),                                                                               \
       &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
       false,                                                                                 \
@@ -3055,6 +9262,7 @@ static inline void *cc_set_next(
       CC_KEY_HASH( *(cntr) ),                                                                \
       CC_KEY_CMPR( *(cntr) ),                                                                \
       CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
       CC_EL_DTOR( *(cntr) ),                                                                 \
       CC_REALLOC_FN,                                                                         \
       CC_FREE_FN                                                                             \
@@ -3066,10 +9274,21 @@ static inline void *cc_set_next(
 #define cc_get_or_insert_3( cntr, key, el )                                                  \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
-  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_MAP ),                                       \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                         \
+  ),                                                                                         \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    cc_map_insert(                                                                           \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_insert  :                                    \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_insert :                                    \
+                           /* CC_DMAP */ cc_dmap_insert                                      \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
       *(cntr),                                                                               \
       &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                       \
       &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
@@ -3079,6 +9298,44 @@ static inline void *cc_set_next(
       CC_KEY_HASH( *(cntr) ),                                                                \
       CC_KEY_CMPR( *(cntr) ),                                                                \
       CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_EL_DTOR( *(cntr) ),                                                                 \
+      CC_KEY_DTOR( *(cntr) ),                                                                \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
+  ),                                                                                         \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                            \
+
+#define cc_get_or_insert_uninit( cntr, key, inserted )                                       \
+(                                                                                            \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                         \
+  ),                                                                                         \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
+    *(cntr),                                                                                 \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_get_or_insert_uninit  :                      \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_get_or_insert_uninit :                      \
+                           /* CC_DMAP */ cc_dmap_get_or_insert_uninit                        \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    (                                                                                        \
+      *(cntr),                                                                               \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                     \
+      (inserted),                                                                            \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      CC_LAYOUT( *(cntr) ),                                                                  \
+      CC_KEY_HASH( *(cntr) ),                                                                \
+      CC_KEY_CMPR( *(cntr) ),                                                                \
+      CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                        \
       CC_EL_DTOR( *(cntr) ),                                                                 \
       CC_KEY_DTOR( *(cntr) ),                                                                \
       CC_REALLOC_FN,                                                                         \
@@ -3088,21 +9345,82 @@ static inline void *cc_set_next(
   CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                                            \
 
+#define cc_get_or_insert_with_hash( ... ) CC_SELECT_ON_NUM_ARGS( cc_get_or_insert_with_hash, __VA_ARGS__ )
+
+#define cc_get_or_insert_with_hash_3( cntr, key, hash_val )                                 \
+(                                                                                           \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                   \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_SET ),                                      \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                      \
+    *(cntr),                                                                                \
+    cc_set_insert_hashed(                                                                   \
+      *(cntr),                                                                              \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                    \
+      (hash_val),                                                                           \
+      false,                                                                                \
+      CC_LAYOUT( *(cntr) ),                                                                 \
+      CC_KEY_HASH( *(cntr) ),                                                               \
+      CC_KEY_CMPR( *(cntr) ),                                                               \
+      CC_KEY_LOAD( *(cntr) ),                                                               \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                       \
+      CC_EL_DTOR( *(cntr) ),                                                                \
+      CC_REALLOC_FN,                                                                        \
+      CC_FREE_FN                                                                            \
+    )                                                                                       \
+  ),                                                                                        \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )\
+)                                                                                           \
+                                                                                            \
+
+#define cc_get_or_insert_with_hash_4( cntr, key, el, hash_val )                             \
+(                                                                                           \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                   \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_MAP ),                                      \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                      \
+    *(cntr),                                                                                \
+    cc_map_insert_hashed(                                                                   \
+      *(cntr),                                                                              \
+      &CC_MAKE_LVAL_COPY( CC_EL_TY( *(cntr) ), (el) ),                                      \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                                    \
+      (hash_val),                                                                           \
+      false,                                                                                \
+      CC_EL_SIZE( *(cntr) ),                                                                \
+      CC_LAYOUT( *(cntr) ),                                                                 \
+      CC_KEY_HASH( *(cntr) ),                                                               \
+      CC_KEY_CMPR( *(cntr) ),                                                               \
+      CC_KEY_LOAD( *(cntr) ),                                                               \
+      CC_KEY_MAX_PROBELEN( *(cntr) ),                                                       \
+      CC_EL_DTOR( *(cntr) ),                                                                \
+      CC_KEY_DTOR( *(cntr) ),                                                               \
+      CC_REALLOC_FN,                                                                        \
+      CC_FREE_FN                                                                            \
+    )                                                                                       \
+  ),                                                                                        \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )\
+)                                                                                           \
+                                                                                            \
+
 #define cc_get( cntr, key )                                            \
 (                                                                      \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                              \
   CC_STATIC_ASSERT(                                                    \
-    CC_CNTR_ID( *(cntr) ) == CC_VEC ||                                 \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                 \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_CAST_MAYBE_UNUSED(                                                \
     CC_EL_TY( *(cntr) ) *,                                             \
     /* Function select */                                              \
     (                                                                  \
-      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_get :                  \
-      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_get :                  \
-                            /* CC_SET */ cc_set_get                    \
+      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_get  :                 \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_get  :                 \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_get  :                 \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_get :                 \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_get :                 \
+                           /* CC_DMAP */ cc_dmap_get                   \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3116,72 +9434,458 @@ static inline void *cc_set_next(
   )                                                                    \
 )                                                                      \
 
+#define cc_get_with_hash( cntr, key, hash_val )                       \
+(                                                                     \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                             \
+  CC_STATIC_ASSERT(                                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                                   \
+  ),                                                                  \
+  CC_CAST_MAYBE_UNUSED(                                               \
+    CC_EL_TY( *(cntr) ) *,                                            \
+    /* Function select */                                             \
+    (                                                                 \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_get_hashed :          \
+                            /* CC_SET */ cc_set_get_hashed            \
+    )                                                                 \
+    /* Function args */                                               \
+    (                                                                 \
+      *(cntr),                                                        \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),              \
+      (hash_val),                                                     \
+      CC_EL_SIZE( *(cntr) ),                                          \
+      CC_LAYOUT( *(cntr) ),                                           \
+      CC_KEY_CMPR( *(cntr) )                                          \
+    )                                                                 \
+  )                                                                   \
+)                                                                     \
+                                                                      \
+
+#define cc_hash_of( cntr, key )                                                   \
+(                                                                                 \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                         \
+  CC_STATIC_ASSERT(                                                               \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                            \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                                               \
+  ),                                                                              \
+  CC_KEY_HASH( *(cntr) )( &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ) )     \
+)                                                                                 \
+                                                                                  \
+
+#define cc_get_n( cntr, keys, n, out )                                 \
+(                                                                      \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                              \
+  CC_STATIC_ASSERT(                                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                 \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+  ),                                                                   \
+  /* Function select */                                                \
+  (                                                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_get_n :                  \
+                          /* CC_SET */ cc_set_get_n                    \
+  )                                                                    \
+  /* Function args */                                                  \
+  (                                                                    \
+    *(cntr),                                                           \
+    (keys),                                                            \
+    (n),                                                               \
+    (out),                                                             \
+    CC_EL_SIZE( *(cntr) ),                                             \
+    CC_LAYOUT( *(cntr) ),                                              \
+    CC_KEY_HASH( *(cntr) ),                                            \
+    CC_KEY_CMPR( *(cntr) )                                             \
+  )                                                                    \
+)                                                                      \
+
+#define cc_lower_bound( cntr, key )                                   \
+(                                                                     \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                             \
+  CC_STATIC_ASSERT(                                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                               \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET                                  \
+  ),                                                                  \
+  CC_CAST_MAYBE_UNUSED(                                               \
+    CC_EL_TY( *(cntr) ) *,                                            \
+    /* Function select */                                             \
+    (                                                                 \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_lower_bound :        \
+                           /* CC_OSET */ cc_oset_lower_bound          \
+    )                                                                 \
+    /* Function args */                                               \
+    (                                                                 \
+      *(cntr),                                                        \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),              \
+      CC_EL_SIZE( *(cntr) ),                                          \
+      CC_LAYOUT( *(cntr) ),                                           \
+      CC_KEY_CMPR( *(cntr) )                                          \
+    )                                                                 \
+  )                                                                   \
+)                                                                     \
+
+#define cc_upper_bound( cntr, key )                                   \
+(                                                                     \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                             \
+  CC_STATIC_ASSERT(                                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                               \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET                                  \
+  ),                                                                  \
+  CC_CAST_MAYBE_UNUSED(                                               \
+    CC_EL_TY( *(cntr) ) *,                                            \
+    /* Function select */                                             \
+    (                                                                 \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_upper_bound :        \
+                           /* CC_OSET */ cc_oset_upper_bound          \
+    )                                                                 \
+    /* Function args */                                               \
+    (                                                                 \
+      *(cntr),                                                        \
+      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),              \
+      CC_EL_SIZE( *(cntr) ),                                          \
+      CC_LAYOUT( *(cntr) ),                                           \
+      CC_KEY_CMPR( *(cntr) )                                          \
+    )                                                                 \
+  )                                                                   \
+)                                                                     \
+
 #define cc_key_for( cntr, itr )                                                              \
 (                                                                                            \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
-  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_MAP ),                                       \
+  CC_STATIC_ASSERT(                                                                          \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                                         \
+  ),                                                                                         \
   CC_CAST_MAYBE_UNUSED(                                                                      \
     const CC_KEY_TY( *(cntr) ) *,                                                            \
-    cc_map_key_for( (itr), CC_EL_SIZE( *(cntr) ), CC_LAYOUT( *(cntr) ) )                     \
+    /* Function select */                                                                    \
+    (                                                                                        \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_key_for  :                                   \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_key_for :                                   \
+                           /* CC_DMAP */ cc_dmap_key_for                                     \
+    )                                                                                        \
+    /* Function args */                                                                      \
+    ( *(cntr), (itr), CC_EL_SIZE( *(cntr) ), CC_LAYOUT( *(cntr) ) )                          \
   )                                                                                          \
 )                                                                                            \
 
-#define cc_erase( cntr, key )                                           \
-(                                                                       \
-  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                               \
-  CC_STATIC_ASSERT(                                                     \
-    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                 \
-    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                 \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                 \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                     \
-  ),                                                                    \
-  CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2(                                  \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP || CC_CNTR_ID( *(cntr) ) == CC_SET, \
-    bool,                                                               \
-    CC_EL_TY( *(cntr) ) *,                                              \
-    /* Function select */                                               \
-    (                                                                   \
-      CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_erase  :                \
-      CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_erase :                \
-      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase  :                \
-                            /* CC_SET */ cc_set_erase                   \
-    )                                                                   \
-    /* Function args */                                                 \
-    (                                                                   \
-      *(cntr),                                                          \
-      &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                \
-      CC_EL_SIZE( *(cntr) ),                                            \
-      CC_LAYOUT( *(cntr) ),                                             \
-      CC_KEY_HASH( *(cntr) ),                                           \
-      CC_KEY_CMPR( *(cntr) ),                                           \
-      CC_EL_DTOR( *(cntr) ),                                            \
-      CC_KEY_DTOR( *(cntr) ),                                           \
-      CC_FREE_FN                                                        \
-    )                                                                   \
-  )                                                                     \
-)                                                                       \
+// Selects the auto-shrink function through which the erasing API macros below pass their results (see
+// cc_no_auto_shrink).
+#define CC_AUTO_SHRINK_FN( cntr )                     \
+(                                                     \
+  CC_CNTR_ID( cntr ) == CC_VEC ? cc_vec_auto_shrink : \
+  CC_CNTR_ID( cntr ) == CC_MAP ? cc_map_auto_shrink : \
+  CC_CNTR_ID( cntr ) == CC_SET ? cc_set_auto_shrink : \
+                                 cc_no_auto_shrink    \
+)                                                     \
+
+#define cc_erase( cntr, key )                                            \
+(                                                                        \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                \
+  CC_STATIC_ASSERT(                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                     \
+  ),                                                                     \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                   \
+    *(cntr),                                                             \
+    CC_AUTO_SHRINK_FN( *(cntr) )(                                        \
+      *(cntr),                                                           \
+      /* Function select */                                              \
+      (                                                                  \
+        CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_erase  :               \
+        CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_erase :               \
+        CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase  :               \
+        CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_erase  :               \
+        CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_erase :               \
+        CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_erase :               \
+                             /* CC_DMAP */ cc_dmap_erase                 \
+      )                                                                  \
+      /* Function args */                                                \
+      (                                                                  \
+        *(cntr),                                                         \
+        &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),               \
+        CC_EL_SIZE( *(cntr) ),                                           \
+        CC_LAYOUT( *(cntr) ),                                            \
+        CC_KEY_HASH( *(cntr) ),                                          \
+        CC_KEY_CMPR( *(cntr) ),                                          \
+        CC_EL_DTOR( *(cntr) ),                                           \
+        CC_KEY_DTOR( *(cntr) ),                                          \
+        CC_FREE_FN                                                       \
+      ),                                                                 \
+      CC_EL_SIZE( *(cntr) ),                                             \
+      CC_LAYOUT( *(cntr) ),                                              \
+      CC_KEY_HASH( *(cntr) ),                                            \
+      CC_KEY_LOAD( *(cntr) ),                                            \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                       \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ), \
+      CC_REALLOC_FN,                                                     \
+      CC_FREE_FN                                                         \
+    )                                                                    \
+  ),                                                                     \
+  CC_IF_THEN_CAST_TY_1_ELSE_CAST_TY_2(                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP,                                    \
+    bool,                                                                \
+    CC_EL_TY( *(cntr) ) *,                                               \
+    CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) )                          \
+  )                                                                      \
+)                                                                        \
+
+#define cc_erase_n( cntr, index, n )                                                         \
+(                                                                                            \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                    \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                       \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
+    *(cntr),                                                                                 \
+    cc_vec_auto_shrink(                                                                      \
+      *(cntr),                                                                               \
+      cc_vec_erase_n( *(cntr), (index), (n), CC_EL_SIZE( *(cntr) ), CC_EL_DTOR( *(cntr) ) ), \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      CC_LAYOUT( *(cntr) ),                                                                  \
+      CC_KEY_HASH( *(cntr) ),                                                                \
+      CC_KEY_LOAD( *(cntr) ),                                                                \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                                           \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                     \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
+  ),                                                                                         \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                            \
+
+#define cc_erase_swap( cntr, index )                                                            \
+(                                                                                               \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                       \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                          \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                          \
+    *(cntr),                                                                                    \
+    cc_vec_auto_shrink(                                                                         \
+      *(cntr),                                                                                  \
+      cc_vec_erase_swap_n( *(cntr), (index), 1, CC_EL_SIZE( *(cntr) ), CC_EL_DTOR( *(cntr) ) ), \
+      CC_EL_SIZE( *(cntr) ),                                                                    \
+      CC_LAYOUT( *(cntr) ),                                                                     \
+      CC_KEY_HASH( *(cntr) ),                                                                   \
+      CC_KEY_LOAD( *(cntr) ),                                                                   \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                                              \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                        \
+      CC_REALLOC_FN,                                                                            \
+      CC_FREE_FN                                                                                \
+    )                                                                                           \
+  ),                                                                                            \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )    \
+)                                                                                               \
+
+#define cc_erase_swap_n( cntr, index, n )                                                         \
+(                                                                                                 \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                         \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                            \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                            \
+    *(cntr),                                                                                      \
+    cc_vec_auto_shrink(                                                                           \
+      *(cntr),                                                                                    \
+      cc_vec_erase_swap_n( *(cntr), (index), (n), CC_EL_SIZE( *(cntr) ), CC_EL_DTOR( *(cntr) ) ), \
+      CC_EL_SIZE( *(cntr) ),                                                                      \
+      CC_LAYOUT( *(cntr) ),                                                                       \
+      CC_KEY_HASH( *(cntr) ),                                                                     \
+      CC_KEY_LOAD( *(cntr) ),                                                                     \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                                                \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                          \
+      CC_REALLOC_FN,                                                                              \
+      CC_FREE_FN                                                                                  \
+    )                                                                                             \
+  ),                                                                                              \
+  CC_CAST_MAYBE_UNUSED( CC_EL_TY( *(cntr) ) *, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )      \
+)                                                                                                 \
+
+#define cc_erase_with_hash( cntr, key, hash_val )                           \
+(                                                                           \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                   \
+  CC_STATIC_ASSERT(                                                         \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                                         \
+  ),                                                                        \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                      \
+    *(cntr),                                                                \
+    CC_AUTO_SHRINK_FN( *(cntr) )(                                           \
+      *(cntr),                                                              \
+      /* Function select */                                                 \
+      (                                                                     \
+        CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase_hashed :            \
+                              /* CC_SET */ cc_set_erase_hashed              \
+      )                                                                     \
+      /* Function args */                                                   \
+      (                                                                     \
+        *(cntr),                                                            \
+        &CC_MAKE_LVAL_COPY( CC_KEY_TY( *(cntr) ), (key) ),                  \
+        (hash_val),                                                         \
+        CC_EL_SIZE( *(cntr) ),                                              \
+        CC_LAYOUT( *(cntr) ),                                               \
+        CC_KEY_HASH( *(cntr) ),                                             \
+        CC_KEY_CMPR( *(cntr) ),                                             \
+        CC_EL_DTOR( *(cntr) ),                                              \
+        CC_KEY_DTOR( *(cntr) ),                                             \
+        CC_FREE_FN                                                          \
+      ),                                                                    \
+      CC_EL_SIZE( *(cntr) ),                                                \
+      CC_LAYOUT( *(cntr) ),                                                 \
+      CC_KEY_HASH( *(cntr) ),                                               \
+      CC_KEY_LOAD( *(cntr) ),                                               \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                          \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),    \
+      CC_REALLOC_FN,                                                        \
+      CC_FREE_FN                                                            \
+    )                                                                       \
+  ),                                                                        \
+  CC_CAST_MAYBE_UNUSED( bool, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                           \
 
-#define cc_erase_n( cntr, index, n )                                                      \
-(                                                                                         \
-  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                 \
-  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                    \
-  CC_CAST_MAYBE_UNUSED(                                                                   \
-    CC_EL_TY( *(cntr) ) *,                                                                \
-    cc_vec_erase_n( *(cntr), (index), (n), CC_EL_SIZE( *(cntr) ), CC_EL_DTOR( *(cntr) ) ) \
-  )                                                                                       \
-)                                                                                         \
+#define cc_erase_keys( cntr, keys, n )                                                   \
+(                                                                                        \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                \
+  CC_STATIC_ASSERT(                                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                                                      \
+  ),                                                                                     \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                   \
+    *(cntr),                                                                             \
+    CC_AUTO_SHRINK_FN( *(cntr) )(                                                        \
+      *(cntr),                                                                           \
+      &CC_MAKE_LVAL_COPY(                                                                \
+        size_t,                                                                          \
+        /* Function select */                                                            \
+        (                                                                                \
+          CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase_keys :                         \
+                                /* CC_SET */ cc_set_erase_keys                           \
+        )                                                                                \
+        /* Function args */                                                              \
+        (                                                                                \
+          *(cntr),                                                                       \
+          (keys),                                                                        \
+          (n),                                                                           \
+          CC_EL_SIZE( *(cntr) ),                                                         \
+          CC_LAYOUT( *(cntr) ),                                                          \
+          CC_KEY_HASH( *(cntr) ),                                                        \
+          CC_KEY_CMPR( *(cntr) ),                                                        \
+          CC_EL_DTOR( *(cntr) ),                                                         \
+          CC_KEY_DTOR( *(cntr) ),                                                        \
+          CC_FREE_FN                                                                     \
+        )                                                                                \
+      ),                                                                                 \
+      CC_EL_SIZE( *(cntr) ),                                                             \
+      CC_LAYOUT( *(cntr) ),                                                              \
+      CC_KEY_HASH( *(cntr) ),                                                            \
+      CC_KEY_LOAD( *(cntr) ),                                                            \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                                       \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                 \
+      CC_REALLOC_FN,                                                                     \
+      CC_FREE_FN                                                                         \
+    )                                                                                    \
+  ),                                                                                     \
+  CC_CAST_MAYBE_UNUSED( size_t, *(size_t *)CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                        \
+
+#define cc_erase_if( cntr, pred )                                                        \
+(                                                                                        \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                                                \
+  CC_STATIC_ASSERT(                                                                      \
+    CC_CNTR_ID( *(cntr) ) == CC_VEC ||                                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                                                   \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                                                      \
+  ),                                                                                     \
+  CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                   \
+    *(cntr),                                                                             \
+    CC_AUTO_SHRINK_FN( *(cntr) )(                                                        \
+      *(cntr),                                                                           \
+      &CC_MAKE_LVAL_COPY(                                                                \
+        size_t,                                                                          \
+        /* Function select */                                                            \
+        (                                                                                \
+          CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_erase_if :                           \
+          CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase_if :                           \
+                                /* CC_SET */ cc_set_erase_if                             \
+        )                                                                                \
+        /* Function args */                                                              \
+        (                                                                                \
+          *(cntr),                                                                       \
+          (cc_pred_fnptr_ty)(cc_generic_fnptr_ty)(pred),                                 \
+          CC_EL_SIZE( *(cntr) ),                                                         \
+          CC_LAYOUT( *(cntr) ),                                                          \
+          CC_KEY_HASH( *(cntr) ),                                                        \
+          CC_EL_DTOR( *(cntr) ),                                                         \
+          CC_KEY_DTOR( *(cntr) ),                                                        \
+          CC_FREE_FN                                                                     \
+        )                                                                                \
+      ),                                                                                 \
+      CC_EL_SIZE( *(cntr) ),                                                             \
+      CC_LAYOUT( *(cntr) ),                                                              \
+      CC_KEY_HASH( *(cntr) ),                                                            \
+      CC_KEY_LOAD( *(cntr) ),                                                            \
+      CC_CNTR_MIN_LOAD( *(cntr) ),                                                       \
+      &CC_MAKE_LVAL_COPY( cc_vec_growth_ty, CC_CNTR_GROWTH( *(cntr) ) ),                 \
+      CC_REALLOC_FN,                                                                     \
+      CC_FREE_FN                                                                         \
+    )                                                                                    \
+  ),                                                                                     \
+  CC_CAST_MAYBE_UNUSED( size_t, *(size_t *)CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
+)                                                                                        \
+
+#define cc_sort( cntr )                                   \
+(                                                         \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                 \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),    \
+  CC_STATIC_ASSERT( CC_HAS_CMPR( CC_EL_TY( *(cntr) ) ) ), \
+  cc_vec_sort(                                            \
+    *(cntr),                                              \
+    CC_EL_SIZE( *(cntr) ),                                \
+    CC_EL_CMPR( *(cntr) ),                                \
+    CC_EL_RADIX_KEY( *(cntr) ),                           \
+    CC_REALLOC_FN,                                        \
+    CC_FREE_FN                                            \
+  )                                                       \
+)                                                         \
+
+#define cc_stable_sort( cntr )                            \
+(                                                         \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                 \
+  CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),    \
+  CC_STATIC_ASSERT( CC_HAS_CMPR( CC_EL_TY( *(cntr) ) ) ), \
+  CC_CAST_MAYBE_UNUSED(                                   \
+    bool,                                                 \
+    cc_vec_stable_sort(                                   \
+      *(cntr),                                            \
+      CC_EL_SIZE( *(cntr) ),                              \
+      CC_EL_CMPR( *(cntr) ),                              \
+      CC_EL_RADIX_KEY( *(cntr) ),                         \
+      CC_REALLOC_FN,                                      \
+      CC_FREE_FN                                          \
+    )                                                     \
+  )                                                       \
+)                                                         \
 
 #define cc_erase_itr( cntr, itr )                                    \
 (                                                                    \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                            \
   CC_STATIC_ASSERT(                                                  \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                               \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                 \
   ),                                                                 \
   /* Function select */                                              \
   (                                                                  \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase_itr :            \
-                          /* CC_SET */ cc_set_erase_itr              \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_erase_itr  :           \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_erase_itr  :           \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_erase_itr :           \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_erase_itr :           \
+                         /* CC_DMAP */ cc_dmap_erase_itr             \
   )                                                                  \
   /* Function args */                                                \
   (                                                                  \
@@ -3212,7 +9916,14 @@ static inline void *cc_set_next(
   CC_STATIC_ASSERT( CC_CNTR_ID( *(cntr) ) == CC_VEC ),                                       \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                                       \
     *(cntr),                                                                                 \
-    cc_vec_resize( *(cntr), n, CC_EL_SIZE( *(cntr) ), CC_EL_DTOR( *(cntr) ), CC_REALLOC_FN ) \
+    cc_vec_resize(                                                                           \
+      *(cntr),                                                                               \
+      n,                                                                                     \
+      CC_EL_SIZE( *(cntr) ),                                                                 \
+      CC_EL_DTOR( *(cntr) ),                                                                 \
+      CC_REALLOC_FN,                                                                         \
+      CC_FREE_FN                                                                             \
+    )                                                                                        \
   ),                                                                                         \
   CC_CAST_MAYBE_UNUSED( bool, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) )                  \
 )                                                                                            \
@@ -3224,7 +9935,8 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                     \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                     \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                     \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                         \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                     \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                        \
   ),                                                                        \
   CC_POINT_HNDL_TO_ALLOCING_FN_RESULT(                                      \
     *(cntr),                                                                \
@@ -3232,13 +9944,14 @@ static inline void *cc_set_next(
     (                                                                       \
       CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_shrink :                    \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_shrink :                    \
-                            /* CC_SET */ cc_set_shrink                      \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_shrink :                    \
+                           /* CC_DMAP */ cc_dmap_shrink                     \
     )                                                                       \
     /* Function args */                                                     \
     (                                                                       \
       *(cntr),                                                              \
       CC_EL_SIZE( *(cntr) ),                                                \
-      CC_LAYOUT( *(cntr) ),      \
+      CC_LAYOUT( *(cntr) ),                                                 \
       CC_KEY_HASH( *(cntr) ),                                               \
       CC_KEY_LOAD( *(cntr) ),                                               \
       CC_REALLOC_FN,                                                        \
@@ -3248,6 +9961,27 @@ static inline void *cc_set_next(
   CC_CAST_MAYBE_UNUSED( bool, CC_FIX_HNDL_AND_RETURN_OTHER_PTR( *(cntr) ) ) \
 )                                                                           \
 
+#define cc_stats( cntr )                                  \
+(                                                         \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                 \
+  CC_STATIC_ASSERT(                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ||                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET                       \
+  ),                                                      \
+  /* Function select */                                   \
+  (                                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP ? cc_map_stats :      \
+                         /* CC_SET */ cc_set_stats        \
+  )                                                       \
+  /* Function args */                                     \
+  (                                                       \
+    *(cntr),                                              \
+    CC_EL_SIZE( *(cntr) ),                                \
+    CC_LAYOUT( *(cntr) ),                                 \
+    CC_KEY_LOAD( *(cntr) )                                \
+  )                                                       \
+)                                                         \
+
 #define cc_init_clone( cntr, src )                                     \
 (                                                                      \
   CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                              \
@@ -3255,7 +9989,10 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_STATIC_ASSERT( CC_IS_SAME_TY( *(cntr), *(src) ) ),                \
   CC_CAST_MAYBE_UNUSED(                                                \
@@ -3266,7 +10003,10 @@ static inline void *cc_set_next(
       CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_init_clone  :          \
       CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_init_clone :          \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_init_clone  :          \
-                            /* CC_SET */ cc_set_init_clone             \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_init_clone  :          \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_init_clone :          \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_init_clone :          \
+                           /* CC_DMAP */ cc_dmap_init_clone            \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3286,14 +10026,20 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                              \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                              \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                              \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                 \
   ),                                                                 \
   /* Function select */                                              \
   (                                                                  \
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_clear  :               \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_clear :               \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_clear  :               \
-                          /* CC_SET */ cc_set_clear                  \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_clear  :               \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_clear :               \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_clear :               \
+                         /* CC_DMAP */ cc_dmap_clear                 \
   )                                                                  \
   /* Function args */                                                \
   (                                                                  \
@@ -3313,14 +10059,20 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                              \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                              \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                              \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                  \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                              \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                 \
   ),                                                                 \
   /* Function select */                                              \
   (                                                                  \
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_cleanup  :             \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_cleanup :             \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_cleanup  :             \
-                          /* CC_SET */ cc_set_cleanup                \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_cleanup  :             \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_cleanup :             \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_cleanup :             \
+                         /* CC_DMAP */ cc_dmap_cleanup               \
   )                                                                  \
   /* Function args */                                                \
   (                                                                  \
@@ -3334,28 +10086,34 @@ static inline void *cc_set_next(
   cc_init( cntr )                                                    \
 )                                                                    \
 
-#define cc_r_end( cntr )                                 \
-(                                                        \
-  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                \
-  CC_STATIC_ASSERT(                                      \
-    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                  \
-    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                  \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                      \
-  ),                                                     \
-  CC_CAST_MAYBE_UNUSED(                                  \
-    CC_EL_TY( *(cntr) ) *,                               \
-    /* Function select */                                \
-    (                                                    \
-      CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_r_end : \
-      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_r_end  : \
-                            /* CC_SET */ cc_set_r_end    \
-    )                                                    \
-    /* Function args */                                  \
-    (                                                    \
-      *(cntr)                                            \
-    )                                                    \
-  )                                                      \
-)                                                        \
+#define cc_r_end( cntr )                                  \
+(                                                         \
+  CC_WARN_DUPLICATE_SIDE_EFFECTS( cntr ),                 \
+  CC_STATIC_ASSERT(                                       \
+    CC_CNTR_ID( *(cntr) ) == CC_LIST ||                   \
+    CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                   \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                   \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                   \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                   \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                      \
+  ),                                                      \
+  CC_CAST_MAYBE_UNUSED(                                   \
+    CC_EL_TY( *(cntr) ) *,                                \
+    /* Function select */                                 \
+    (                                                     \
+      CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_r_end :  \
+      CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_r_end  :  \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_r_end  :  \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_r_end :  \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_r_end :  \
+                           /* CC_DMAP */ cc_dmap_r_end    \
+    )                                                     \
+    /* Function args */                                   \
+    (                                                     \
+      *(cntr)                                             \
+    )                                                     \
+  )                                                       \
+)                                                         \
 
 #define cc_end( cntr )                                                 \
 (                                                                      \
@@ -3364,7 +10122,10 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_CAST_MAYBE_UNUSED(                                                \
     CC_EL_TY( *(cntr) ) *,                                             \
@@ -3373,7 +10134,10 @@ static inline void *cc_set_next(
       CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_end  :                 \
       CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_end :                 \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_end  :                 \
-                            /* CC_SET */ cc_set_end                    \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_end  :                 \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_end :                 \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_end :                 \
+                           /* CC_DMAP */ cc_dmap_end                   \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3391,7 +10155,10 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_CAST_MAYBE_UNUSED(                                                \
     CC_EL_TY( *(cntr) ) *,                                             \
@@ -3400,7 +10167,10 @@ static inline void *cc_set_next(
       CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_first  :               \
       CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_first :               \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_first  :               \
-                            /* CC_SET */ cc_set_first                  \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_first  :               \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_first :               \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_first :               \
+                           /* CC_DMAP */ cc_dmap_first                 \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3418,7 +10188,10 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_CAST_MAYBE_UNUSED(                                                \
     CC_EL_TY( *(cntr) ) *,                                             \
@@ -3427,7 +10200,10 @@ static inline void *cc_set_next(
       CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_last  :                \
       CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_last :                \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_last  :                \
-                            /* CC_SET */ cc_set_last                   \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_last  :                \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_last :                \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_last :                \
+                           /* CC_DMAP */ cc_dmap_last                  \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3445,7 +10221,10 @@ static inline void *cc_set_next(
     CC_CNTR_ID( *(cntr) ) == CC_VEC  ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_CAST_MAYBE_UNUSED(                                                \
     CC_EL_TY( *(cntr) ) *,                                             \
@@ -3454,7 +10233,10 @@ static inline void *cc_set_next(
       CC_CNTR_ID( *(cntr) ) == CC_VEC  ? cc_vec_next  :                \
       CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_next :                \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_next  :                \
-                            /* CC_SET */ cc_set_next                   \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_next  :                \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_next :                \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_next :                \
+                           /* CC_DMAP */ cc_dmap_next                  \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3472,7 +10254,10 @@ static inline void *cc_set_next(
   CC_STATIC_ASSERT(                                                    \
     CC_CNTR_ID( *(cntr) ) == CC_LIST ||                                \
     CC_CNTR_ID( *(cntr) ) == CC_MAP  ||                                \
-    CC_CNTR_ID( *(cntr) ) == CC_SET                                    \
+    CC_CNTR_ID( *(cntr) ) == CC_SET  ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OMAP ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_OSET ||                                \
+    CC_CNTR_ID( *(cntr) ) == CC_DMAP                                   \
   ),                                                                   \
   CC_CAST_MAYBE_UNUSED(                                                \
     CC_EL_TY( *(cntr) ) *,                                             \
@@ -3480,7 +10265,10 @@ static inline void *cc_set_next(
     (                                                                  \
       CC_CNTR_ID( *(cntr) ) == CC_LIST ? cc_list_prev :                \
       CC_CNTR_ID( *(cntr) ) == CC_MAP  ? cc_map_prev  :                \
-                            /* CC_SET */ cc_set_prev                   \
+      CC_CNTR_ID( *(cntr) ) == CC_SET  ? cc_set_prev  :                \
+      CC_CNTR_ID( *(cntr) ) == CC_OMAP ? cc_omap_prev :                \
+      CC_CNTR_ID( *(cntr) ) == CC_OSET ? cc_oset_prev :                \
+                           /* CC_DMAP */ cc_dmap_prev                  \
     )                                                                  \
     /* Function args */                                                \
     (                                                                  \
@@ -3508,13 +10296,14 @@ static inline void *cc_set_next(
 
 #define cc_r_for_each_3( cntr, key_ptr_name, i_name )                                                                  \
   for( CC_EL_TY( *(cntr) ) *i_name = cc_last( cntr ); i_name != cc_r_end( cntr ); i_name = cc_prev( (cntr), i_name ) ) \
-    for( const CC_KEY_TY( *(cntr) ) *key_ptr_name = cc_key_for( (cntr), i ); key_ptr_name; key_ptr_name = NULL )       \
+    for( const CC_KEY_TY( *(cntr) ) *key_ptr_name = cc_key_for( (cntr), i_name ); key_ptr_name; key_ptr_name = NULL )  \
 
 /*--------------------------------------------------------------------------------------------------------------------*/
-/*                         Destructor, comparison, and hash functions and custom load factors                         */
+/*                    Destructor, comparison, and hash functions, custom load factors, and flags                      */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-// Octal counters that support up to 511 of each function type and 511 load factors.
+// Octal counters that support up to 511 of each function type, 511 load factors, 511 max probe lengths, 511 min load
+// factors, 511 growth policies, and 511 sets of flags.
 #define CC_N_DTORS_D1 0 // D1 = digit 1, i.e. least significant digit.
 #define CC_N_DTORS_D2 0
 #define CC_N_DTORS_D3 0
@@ -3527,6 +10316,18 @@ static inline void *cc_set_next(
 #define CC_N_LOADS_D1 0
 #define CC_N_LOADS_D2 0
 #define CC_N_LOADS_D3 0
+#define CC_N_MAX_PROBELENS_D1 0
+#define CC_N_MAX_PROBELENS_D2 0
+#define CC_N_MAX_PROBELENS_D3 0
+#define CC_N_MIN_LOADS_D1 0
+#define CC_N_MIN_LOADS_D2 0
+#define CC_N_MIN_LOADS_D3 0
+#define CC_N_GROWTHS_D1 0
+#define CC_N_GROWTHS_D2 0
+#define CC_N_GROWTHS_D3 0
+#define CC_N_FLAGS_D1 0
+#define CC_N_FLAGS_D2 0
+#define CC_N_FLAGS_D3 0
 
 #define CC_CAT_3_( a, b, c ) a##b##c
 #define CC_CAT_3( a, b, c ) CC_CAT_3_( a, b, c )
@@ -3539,6 +10340,10 @@ static inline void *cc_set_next(
 #define CC_N_CMPRS CC_CAT_4( 0, CC_N_CMPRS_D3, CC_N_CMPRS_D2, CC_N_CMPRS_D1 )
 #define CC_N_HASHS CC_CAT_4( 0, CC_N_HASHS_D3, CC_N_HASHS_D2, CC_N_HASHS_D1 )
 #define CC_N_LOADS CC_CAT_4( 0, CC_N_LOADS_D3, CC_N_LOADS_D2, CC_N_LOADS_D1 )
+#define CC_N_MAX_PROBELENS CC_CAT_4( 0, CC_N_MAX_PROBELENS_D3, CC_N_MAX_PROBELENS_D2, CC_N_MAX_PROBELENS_D1 )
+#define CC_N_MIN_LOADS CC_CAT_4( 0, CC_N_MIN_LOADS_D3, CC_N_MIN_LOADS_D2, CC_N_MIN_LOADS_D1 )
+#define CC_N_GROWTHS CC_CAT_4( 0, CC_N_GROWTHS_D3, CC_N_GROWTHS_D2, CC_N_GROWTHS_D1 )
+#define CC_N_FLAGS CC_CAT_4( 0, CC_N_FLAGS_D3, CC_N_FLAGS_D2, CC_N_FLAGS_D1 )
 
 // CC_FOR_EACH_XXX macros that call macro m with the first argument n, where n = [0, counter XXX ),
 // and the second argument arg.
@@ -3582,10 +10387,16 @@ CC_CAT_2( CC_R3_, d3 )( m, arg )               \
 #define CC_FOR_EACH_CMPR( m, arg ) CC_FOR_OCT_COUNT( m, arg, CC_N_CMPRS_D3, CC_N_CMPRS_D2, CC_N_CMPRS_D1 )
 #define CC_FOR_EACH_HASH( m, arg ) CC_FOR_OCT_COUNT( m, arg, CC_N_HASHS_D3, CC_N_HASHS_D2, CC_N_HASHS_D1 )
 #define CC_FOR_EACH_LOAD( m, arg ) CC_FOR_OCT_COUNT( m, arg, CC_N_LOADS_D3, CC_N_LOADS_D2, CC_N_LOADS_D1 )
-
-// Macros for inferring the destructor, comparison, or hash function or load factor associated with a container's
-// key or element type, as well as for determining whether a comparison or hash function exists for a type and inferring
-// certain map function arguments in bulk (argument packs) from they key type.
+#define CC_FOR_EACH_MAX_PROBELEN( m, arg ) \
+CC_FOR_OCT_COUNT( m, arg, CC_N_MAX_PROBELENS_D3, CC_N_MAX_PROBELENS_D2, CC_N_MAX_PROBELENS_D1 )
+#define CC_FOR_EACH_MIN_LOAD( m, arg ) \
+CC_FOR_OCT_COUNT( m, arg, CC_N_MIN_LOADS_D3, CC_N_MIN_LOADS_D2, CC_N_MIN_LOADS_D1 )
+#define CC_FOR_EACH_GROWTH( m, arg ) CC_FOR_OCT_COUNT( m, arg, CC_N_GROWTHS_D3, CC_N_GROWTHS_D2, CC_N_GROWTHS_D1 )
+#define CC_FOR_EACH_FLAGS( m, arg ) CC_FOR_OCT_COUNT( m, arg, CC_N_FLAGS_D3, CC_N_FLAGS_D2, CC_N_FLAGS_D1 )
+
+// Macros for inferring the destructor, comparison, or hash function, load factor, max probe length, min load factor,
+// growth policy, or flags associated with a container's key or element type, as well as for determining whether a comparison or hash
+// function exists for a type and inferring certain map function arguments in bulk (argument packs) from they key type.
 // In C, we use the CC_FOR_EACH_XXXX macros above to create _Generic expressions that select the correct user-defined
 // function or load factor for the container's key or element types.
 // For comparison and hash functions, the list of user-defined functions is followed by a nested _Generic statement
@@ -3596,6 +10407,12 @@ CC_CAT_2( CC_R3_, d3 )( m, arg )               \
 // defines multiple functions (e.g. multiple destructors) for the same type.
 // Hence, it is up to the user to make sure they are not doing that if they are compiling for C++.
 
+// CC_EL_RADIX_KEY infers whether sort can radix sort a vector's elements, i.e. whether the element type is a
+// fundamental integer type without a user-defined comparison function.
+// If so, it returns a descriptor of the type's radix sort key, namely its width in bytes shifted one bit to the left
+// and combined with a bit denoting whether it is signed, and zero otherwise.
+#define CC_RADIX_KEY( ty, is_signed ) ( sizeof( ty ) << 1 | (size_t)( is_signed ) )
+
 #ifdef __cplusplus
 
 #define CC_EL_DTOR_SLOT( n, arg ) std::is_same<arg, cc_dtor_##n##_ty>::value ? cc_dtor_##n##_fn :
@@ -3653,6 +10470,45 @@ std::is_same<CC_TYPEOF_XP(**arg), CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( arg ), cc_cmp
   (int (*)( void *, void * ))NULL                                                                            \
 )                                                                                                            \
 
+#define CC_EL_CMPR_SLOT( n, arg ) std::is_same<arg, cc_cmpr_##n##_ty>::value ? cc_cmpr_##n##_fn :
+#define CC_EL_CMPR( cntr )                                                                 \
+(                                                                                          \
+  CC_FOR_EACH_CMPR( CC_EL_CMPR_SLOT, CC_EL_TY( cntr ) )                                    \
+  std::is_same<CC_EL_TY( cntr ), char>::value               ? cc_cmpr_char               : \
+  std::is_same<CC_EL_TY( cntr ), unsigned char>::value      ? cc_cmpr_unsigned_char      : \
+  std::is_same<CC_EL_TY( cntr ), signed char>::value        ? cc_cmpr_signed_char        : \
+  std::is_same<CC_EL_TY( cntr ), unsigned short>::value     ? cc_cmpr_unsigned_short     : \
+  std::is_same<CC_EL_TY( cntr ), short>::value              ? cc_cmpr_short              : \
+  std::is_same<CC_EL_TY( cntr ), unsigned int>::value       ? cc_cmpr_unsigned_int       : \
+  std::is_same<CC_EL_TY( cntr ), int>::value                ? cc_cmpr_int                : \
+  std::is_same<CC_EL_TY( cntr ), unsigned long>::value      ? cc_cmpr_unsigned_long      : \
+  std::is_same<CC_EL_TY( cntr ), long>::value               ? cc_cmpr_long               : \
+  std::is_same<CC_EL_TY( cntr ), unsigned long long>::value ? cc_cmpr_unsigned_long_long : \
+  std::is_same<CC_EL_TY( cntr ), long long>::value          ? cc_cmpr_long_long          : \
+  std::is_same<CC_EL_TY( cntr ), size_t>::value             ? cc_cmpr_size_t             : \
+  std::is_same<CC_EL_TY( cntr ), char *>::value             ? cc_cmpr_c_string           : \
+  (int (*)( void *, void * ))NULL                                                          \
+)                                                                                          \
+
+#define CC_EL_RADIX_KEY_SLOT( n, arg ) std::is_same<arg, cc_cmpr_##n##_ty>::value ? (size_t)0 :
+#define CC_EL_RADIX_KEY( cntr )                                                                       \
+(                                                                                                     \
+  CC_FOR_EACH_CMPR( CC_EL_RADIX_KEY_SLOT, CC_EL_TY( cntr ) )                                          \
+  std::is_same<CC_EL_TY( cntr ), char>::value               ? CC_RADIX_KEY( char, CHAR_MIN < 0 )    : \
+  std::is_same<CC_EL_TY( cntr ), unsigned char>::value      ? CC_RADIX_KEY( unsigned char, 0 )      : \
+  std::is_same<CC_EL_TY( cntr ), signed char>::value        ? CC_RADIX_KEY( signed char, 1 )        : \
+  std::is_same<CC_EL_TY( cntr ), unsigned short>::value     ? CC_RADIX_KEY( unsigned short, 0 )     : \
+  std::is_same<CC_EL_TY( cntr ), short>::value              ? CC_RADIX_KEY( short, 1 )              : \
+  std::is_same<CC_EL_TY( cntr ), unsigned int>::value       ? CC_RADIX_KEY( unsigned int, 0 )       : \
+  std::is_same<CC_EL_TY( cntr ), int>::value                ? CC_RADIX_KEY( int, 1 )                : \
+  std::is_same<CC_EL_TY( cntr ), unsigned long>::value      ? CC_RADIX_KEY( unsigned long, 0 )      : \
+  std::is_same<CC_EL_TY( cntr ), long>::value               ? CC_RADIX_KEY( long, 1 )               : \
+  std::is_same<CC_EL_TY( cntr ), unsigned long long>::value ? CC_RADIX_KEY( unsigned long long, 0 ) : \
+  std::is_same<CC_EL_TY( cntr ), long long>::value          ? CC_RADIX_KEY( long long, 1 )          : \
+  std::is_same<CC_EL_TY( cntr ), size_t>::value             ? CC_RADIX_KEY( size_t, 0 )             : \
+  (size_t)0                                                                                           \
+)                                                                                                     \
+
 #define CC_KEY_HASH_SLOT( n, arg )                           \
 std::is_same<                                                \
   CC_TYPEOF_XP(**arg),                                       \
@@ -3743,13 +10599,64 @@ std::is_same<                                                \
   CC_DEFAULT_LOAD                            \
 )                                            \
 
-#define CC_LAYOUT( cntr )                                                        \
-cc_layout(                                                                       \
-  CC_CNTR_ID( cntr ),                                                            \
-  CC_EL_SIZE( cntr ),                                                            \
-  alignof( CC_EL_TY( cntr ) ),                                                   \
-  cc_key_details_ty{ sizeof( CC_KEY_TY( cntr ) ), alignof( CC_KEY_TY( cntr ) ) } \
-)                                                                                \
+#define CC_KEY_MAX_PROBELEN_SLOT( n, arg )                           \
+std::is_same<                                                        \
+  CC_TYPEOF_XP(**arg),                                               \
+  CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( arg ), cc_max_probelen_##n##_ty ) \
+>::value ? cc_max_probelen_##n##_val :                               \
+
+#define CC_KEY_MAX_PROBELEN( cntr )                          \
+(                                                            \
+  CC_FOR_EACH_MAX_PROBELEN( CC_KEY_MAX_PROBELEN_SLOT, cntr ) \
+  CC_DEFAULT_MAX_PROBELEN                                    \
+)                                                            \
+
+#define CC_EL_MIN_LOAD_SLOT( n, arg ) std::is_same<arg, cc_min_load_##n##_ty>::value ? cc_min_load_##n##_val :
+#define CC_EL_MIN_LOAD( cntr )                                  \
+(                                                               \
+  CC_FOR_EACH_MIN_LOAD( CC_EL_MIN_LOAD_SLOT, CC_EL_TY( cntr ) ) \
+  CC_DEFAULT_MIN_LOAD                                           \
+)                                                               \
+
+#define CC_KEY_MIN_LOAD_SLOT( n, arg )                           \
+std::is_same<                                                    \
+  CC_TYPEOF_XP(**arg),                                           \
+  CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( arg ), cc_min_load_##n##_ty ) \
+>::value ? cc_min_load_##n##_val :                               \
+
+#define CC_KEY_MIN_LOAD( cntr )                      \
+(                                                    \
+  CC_FOR_EACH_MIN_LOAD( CC_KEY_MIN_LOAD_SLOT, cntr ) \
+  CC_DEFAULT_MIN_LOAD                                \
+)                                                    \
+
+#define CC_EL_GROWTH_SLOT( n, arg ) std::is_same<arg, cc_growth_##n##_ty>::value ? cc_growth_##n##_val :
+#define CC_EL_GROWTH( cntr )                                           \
+(                                                                      \
+  CC_FOR_EACH_GROWTH( CC_EL_GROWTH_SLOT, CC_EL_TY( cntr ) )            \
+  cc_vec_growth_ty{ CC_DEFAULT_GROWTH_FACTOR, CC_DEFAULT_INITIAL_CAP } \
+)                                                                      \
+
+#define CC_KEY_FLAGS_SLOT( n, arg )                           \
+std::is_same<                                                 \
+  CC_TYPEOF_XP(**arg),                                        \
+  CC_MAKE_BASE_FNPTR_TY( CC_EL_TY( arg ), cc_flags_##n##_ty ) \
+>::value ? cc_flags_##n##_val :                               \
+
+#define CC_KEY_FLAGS( cntr )                   \
+(                                              \
+  CC_FOR_EACH_FLAGS( CC_KEY_FLAGS_SLOT, cntr ) \
+  0u                                           \
+)                                              \
+
+#define CC_LAYOUT( cntr )                                                         \
+cc_layout(                                                                        \
+  CC_CNTR_ID( cntr ),                                                             \
+  CC_EL_SIZE( cntr ),                                                             \
+  alignof( CC_EL_TY( cntr ) ),                                                    \
+  cc_key_details_ty{ sizeof( CC_KEY_TY( cntr ) ), alignof( CC_KEY_TY( cntr ) ) }, \
+  CC_KEY_FLAGS( cntr )                                                            \
+)                                                                                 \
 
 #else
 
@@ -3789,6 +10696,49 @@ _Generic( (**cntr),
   )                                                                                            \
 )                                                                                              \
 
+#define CC_EL_CMPR_SLOT( n, arg ) cc_cmpr_##n##_ty: cc_cmpr_##n##_fn,
+#define CC_EL_CMPR( cntr )                          \
+_Generic( (CC_EL_TY( cntr )){ 0 },                  \
+  CC_FOR_EACH_CMPR( CC_EL_CMPR_SLOT, )              \
+  default: _Generic( (CC_EL_TY( cntr )){ 0 },       \
+    char:               cc_cmpr_char,               \
+    unsigned char:      cc_cmpr_unsigned_char,      \
+    signed char:        cc_cmpr_signed_char,        \
+    unsigned short:     cc_cmpr_unsigned_short,     \
+    short:              cc_cmpr_short,              \
+    unsigned int:       cc_cmpr_unsigned_int,       \
+    int:                cc_cmpr_int,                \
+    unsigned long:      cc_cmpr_unsigned_long,      \
+    long:               cc_cmpr_long,               \
+    unsigned long long: cc_cmpr_unsigned_long_long, \
+    long long:          cc_cmpr_long_long,          \
+    cc_maybe_size_t:    cc_cmpr_size_t,             \
+    char *:             cc_cmpr_c_string,           \
+    default:            (cc_cmpr_fnptr_ty)NULL      \
+  )                                                 \
+)                                                   \
+
+#define CC_EL_RADIX_KEY_SLOT( n, arg ) cc_cmpr_##n##_ty: (size_t)0,
+#define CC_EL_RADIX_KEY( cntr )                                \
+_Generic( (CC_EL_TY( cntr )){ 0 },                             \
+  CC_FOR_EACH_CMPR( CC_EL_RADIX_KEY_SLOT, )                    \
+  default: _Generic( (CC_EL_TY( cntr )){ 0 },                  \
+    char:               CC_RADIX_KEY( char, CHAR_MIN < 0 ),    \
+    unsigned char:      CC_RADIX_KEY( unsigned char, 0 ),      \
+    signed char:        CC_RADIX_KEY( signed char, 1 ),        \
+    unsigned short:     CC_RADIX_KEY( unsigned short, 0 ),     \
+    short:              CC_RADIX_KEY( short, 1 ),              \
+    unsigned int:       CC_RADIX_KEY( unsigned int, 0 ),       \
+    int:                CC_RADIX_KEY( int, 1 ),                \
+    unsigned long:      CC_RADIX_KEY( unsigned long, 0 ),      \
+    long:               CC_RADIX_KEY( long, 1 ),               \
+    unsigned long long: CC_RADIX_KEY( unsigned long long, 0 ), \
+    long long:          CC_RADIX_KEY( long long, 1 ),          \
+    cc_maybe_size_t:    CC_RADIX_KEY( size_t, 0 ),             \
+    default:            (size_t)0                              \
+  )                                                            \
+)                                                              \
+
 #define CC_KEY_HASH_SLOT( n, arg ) CC_MAKE_BASE_FNPTR_TY( arg, cc_hash_##n##_ty ): cc_hash_##n##_fn,
 #define CC_KEY_HASH( cntr )                                                                    \
 _Generic( (**cntr),                                                                            \
@@ -3862,6 +10812,36 @@ _Generic( (**cntr),                                      \
   default: CC_DEFAULT_LOAD                               \
 )                                                        \
 
+#define CC_KEY_MAX_PROBELEN_SLOT( n, arg )                                         \
+CC_MAKE_BASE_FNPTR_TY( arg, cc_max_probelen_##n##_ty ): cc_max_probelen_##n##_val, \
+
+#define CC_KEY_MAX_PROBELEN( cntr )                                      \
+_Generic( (**cntr),                                                      \
+  CC_FOR_EACH_MAX_PROBELEN( CC_KEY_MAX_PROBELEN_SLOT, CC_EL_TY( cntr ) ) \
+  default: CC_DEFAULT_MAX_PROBELEN                                       \
+)                                                                        \
+
+#define CC_EL_MIN_LOAD_SLOT( n, arg ) cc_min_load_##n##_ty: cc_min_load_##n##_val,
+#define CC_EL_MIN_LOAD( cntr )                 \
+_Generic( (CC_EL_TY( cntr )){ 0 },             \
+  CC_FOR_EACH_MIN_LOAD( CC_EL_MIN_LOAD_SLOT, ) \
+  default: CC_DEFAULT_MIN_LOAD                 \
+)                                              \
+
+#define CC_KEY_MIN_LOAD_SLOT( n, arg ) CC_MAKE_BASE_FNPTR_TY( arg, cc_min_load_##n##_ty ): cc_min_load_##n##_val,
+#define CC_KEY_MIN_LOAD( cntr )                                  \
+_Generic( (**cntr),                                              \
+  CC_FOR_EACH_MIN_LOAD( CC_KEY_MIN_LOAD_SLOT, CC_EL_TY( cntr ) ) \
+  default: CC_DEFAULT_MIN_LOAD                                   \
+)                                                                \
+
+#define CC_EL_GROWTH_SLOT( n, arg ) cc_growth_##n##_ty: cc_growth_##n##_val,
+#define CC_EL_GROWTH( cntr )                                                        \
+_Generic( (CC_EL_TY( cntr )){ 0 },                                                  \
+  CC_FOR_EACH_GROWTH( CC_EL_GROWTH_SLOT, )                                          \
+  default: ( cc_vec_growth_ty ){ CC_DEFAULT_GROWTH_FACTOR, CC_DEFAULT_INITIAL_CAP } \
+)                                                                                   \
+
 #define CC_KEY_DETAILS_SLOT( n, arg )                                               \
 CC_MAKE_BASE_FNPTR_TY( arg, cc_cmpr_##n##_ty ):                                     \
   ( cc_key_details_ty ){ sizeof( cc_cmpr_##n##_ty ), alignof( cc_cmpr_##n##_ty ) }, \
@@ -3900,12 +10880,33 @@ _Generic( (**cntr),
   )                                                                                         \
 )                                                                                           \
 
-#define CC_LAYOUT( cntr )                                                                                \
-cc_layout( CC_CNTR_ID( cntr ), CC_EL_SIZE( cntr ), alignof( CC_EL_TY( cntr ) ), CC_KEY_DETAILS( cntr ) ) \
+#define CC_KEY_FLAGS_SLOT( n, arg ) CC_MAKE_BASE_FNPTR_TY( arg, cc_flags_##n##_ty ): cc_flags_##n##_val,
+#define CC_KEY_FLAGS( cntr )                               \
+_Generic( (**cntr),                                        \
+  CC_FOR_EACH_FLAGS( CC_KEY_FLAGS_SLOT, CC_EL_TY( cntr ) ) \
+  default: 0u                                              \
+)                                                          \
+
+#define CC_LAYOUT( cntr )      \
+cc_layout(                     \
+  CC_CNTR_ID( cntr ),          \
+  CC_EL_SIZE( cntr ),          \
+  alignof( CC_EL_TY( cntr ) ), \
+  CC_KEY_DETAILS( cntr ),      \
+  CC_KEY_FLAGS( cntr )         \
+)                              \
 
 #endif
 
-// Macros for extracting the type and function body or load factor from user-defined DTOR, CMPR, HASH, and LOAD macros. 
+// Vectors take their min load factor from their element type, whereas maps and sets take it from their key type.
+#define CC_CNTR_MIN_LOAD( cntr )                                                          \
+( CC_CNTR_ID( cntr ) == CC_VEC ? (double)CC_EL_MIN_LOAD( cntr ) : CC_KEY_MIN_LOAD( cntr ) ) \
+
+// Vectors take their growth policy from their element type, but small vectors override its initial capacity.
+#define CC_CNTR_GROWTH( cntr ) cc_vec_svec_growth( CC_EL_GROWTH( cntr ), CC_SVEC_N( cntr ) )
+
+// Macros for extracting the type and function body, load factor, max probe length, min load factor, growth policy, or
+// flags from user-defined DTOR, CMPR, HASH, LOAD, MAX_PROBELEN, MIN_LOAD, GROWTH, and FLAGS macros.
 #define CC_1ST_ARG_( _1, ... )    _1
 #define CC_1ST_ARG( ... )         CC_1ST_ARG_( __VA_ARGS__ )
 #define CC_OTHER_ARGS_( _1, ... ) __VA_ARGS__
@@ -3915,7 +10916,16 @@ cc_layout( CC_CNTR_ID( cntr ), CC_EL_SIZE( cntr ), alignof( CC_EL_TY( cntr ) ),
 
 // Integer types.
 
-// TODO: Unified max_int_t hash function
+// All integer hash functions funnel into a single mixer.
+// Multiplying the key by a constant only propagates entropy towards the high bits, while maps select the home bucket
+// from the low bits.
+// Hence, keys that differ only in their high bits (e.g. multiples of 4096) would all land in a handful of buckets.
+// The final xor-shift folds the high half of the product back into the low bits to prevent such clustering.
+static inline size_t cc_hash_integer( unsigned long long val )
+{
+  val *= 0x9E3779B97F4A7C15ull;
+  return (size_t)( val ^ ( val >> 32 ) );
+}
 
 static inline int cc_cmpr_char( void *void_val_1, void *void_val_2 )
 {
@@ -3957,7 +10967,7 @@ static inline int cc_cmpr_unsigned_short( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_unsigned_short( void *void_val )
 {
-  return *(unsigned short *)void_val * 2654435761ull;
+  return cc_hash_integer( *(unsigned short *)void_val );
 }
 
 static inline int cc_cmpr_short( void *void_val_1, void *void_val_2 )
@@ -3967,7 +10977,7 @@ static inline int cc_cmpr_short( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_short( void *void_val )
 {
-  return *(short *)void_val * 2654435761ull;
+  return cc_hash_integer( *(short *)void_val );
 }
 
 static inline int cc_cmpr_unsigned_int( void *void_val_1, void *void_val_2 )
@@ -3978,7 +10988,7 @@ static inline int cc_cmpr_unsigned_int( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_unsigned_int( void *void_val )
 {
-  return *(unsigned int *)void_val * 2654435761ull;
+  return cc_hash_integer( *(unsigned int *)void_val );
 }
 
 static inline int cc_cmpr_int( void *void_val_1, void *void_val_2 )
@@ -3988,7 +10998,7 @@ static inline int cc_cmpr_int( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_int( void *void_val )
 {
-  return *(int *)void_val * 2654435761ull;
+  return cc_hash_integer( *(int *)void_val );
 }
 
 static inline int cc_cmpr_unsigned_long( void *void_val_1, void *void_val_2 )
@@ -3999,7 +11009,7 @@ static inline int cc_cmpr_unsigned_long( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_unsigned_long( void *void_val )
 {
-  return *(unsigned long *)void_val * 2654435761ull;
+  return cc_hash_integer( *(unsigned long *)void_val );
 }
 
 static inline int cc_cmpr_long( void *void_val_1, void *void_val_2 )
@@ -4009,7 +11019,7 @@ static inline int cc_cmpr_long( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_long( void *void_val )
 {
-  return *(long *)void_val * 2654435761ull;
+  return cc_hash_integer( *(long *)void_val );
 }
 
 static inline int cc_cmpr_unsigned_long_long( void *void_val_1, void *void_val_2 )
@@ -4020,7 +11030,7 @@ static inline int cc_cmpr_unsigned_long_long( void *void_val_1, void *void_val_2
 
 static inline size_t cc_hash_unsigned_long_long( void *void_val )
 {
-  return *(unsigned long long *)void_val * 2654435761ull;
+  return cc_hash_integer( *(unsigned long long *)void_val );
 }
 
 static inline int cc_cmpr_long_long( void *void_val_1, void *void_val_2 )
@@ -4031,7 +11041,7 @@ static inline int cc_cmpr_long_long( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_long_long( void *void_val )
 {
-  return *(long long *)void_val * 2654435761ull;
+  return cc_hash_integer( *(long long *)void_val );
 }
 
 // size_t could be an alias for a fundamental integer type or a distinct type.
@@ -4066,52 +11076,126 @@ static inline int cc_cmpr_size_t( void *void_val_1, void *void_val_2 )
 
 static inline size_t cc_hash_size_t( void *void_val )
 {
-  return *(size_t *)void_val * 2654435761ull;
+  return cc_hash_integer( *(size_t *)void_val );
 }
 
 // Null-terminated C strings.
-// We use FNV-1a because newer, faster alternatives that process word-sized chunks require prior knowledge of the
-// string's length.
+// Rather than hashing one byte at a time, we hash eight-byte words, detecting the terminator within each word via the
+// classic "has zero byte" bit trick.
+// Reading a whole word that extends past the terminator is safe as long as the word does not cross a page boundary, so
+// we assemble any word that would cross one byte by byte.
+// Since the words follow from the string's start rather than from its address, the hash does not depend on alignment.
+
+// Word scanning relies on the terminator's position within a word being that of its lowest set "zero byte" bit.
+#if !defined( _MSC_VER ) && !( defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+#define CC_NO_WORD_SCAN
+#endif
+
+// Sanitizers flag the harmless over-reads.
+#if defined( __SANITIZE_ADDRESS__ ) || defined( __SANITIZE_MEMORY__ )
+#define CC_NO_WORD_SCAN
+#elif defined( __has_feature )
+#if __has_feature( address_sanitizer ) || __has_feature( memory_sanitizer )
+#define CC_NO_WORD_SCAN
+#endif
+#endif
 
 static inline int cc_cmpr_c_string( void *void_val_1, void *void_val_2 )
 {
   return strcmp( *(char **)void_val_1, *(char **)void_val_2 );
 }
 
-#if SIZE_MAX == 0xFFFFFFFF // 32-bit size_t.
+// Mixes one word into the running hash of a string.
+// The shift folds the high half of the product, which depends on all bits of the word, into the low half.
+static inline uint64_t cc_hash_word( uint64_t hash, uint64_t word )
+{
+  hash = ( hash ^ word ) * 0xFF51AFD7ED558CCDull;
+  return hash ^ ( hash >> 32 );
+}
 
-static inline size_t cc_hash_c_string( void *void_val )
+// Hashes len bytes of data eight bytes at a time.
+// This function is also suitable for use in user-defined hash functions for key types that carry their own length.
+// Lengths that are not a multiple of eight are handled by letting the last word overlap the previous one (or, for
+// lengths below eight, by combining overlapping smaller reads), so the function never reads out of bounds.
+// Because the length is mixed into the seed, overlapping bytes do not cause collisions between data of different
+// lengths.
+static inline size_t cc_hash_bytes( const void *data, size_t len )
 {
-    char *val = *(char **)void_val;
-    size_t hash = 0x01000193;
-    while( *val )
-      hash = ( (unsigned char)*val++ ^ hash ) * 0x811c9dc5;
+  const unsigned char *bytes = (const unsigned char *)data;
+  uint64_t hash = cc_hash_word( 0xCBF29CE484222325ull, len );
+  uint64_t word = 0;
 
-    return hash;
+  if( len >= 8 )
+  {
+    const unsigned char *last = bytes + len - 8;
+    for( ; bytes < last; bytes += 8 )
+    {
+      memcpy( &word, bytes, 8 );
+      hash = cc_hash_word( hash, word );
+    }
+
+    memcpy( &word, last, 8 );
+  }
+  else if( len >= 4 )
+  {
+    uint32_t lo;
+    uint32_t hi;
+    memcpy( &lo, bytes, 4 );
+    memcpy( &hi, bytes + len - 4, 4 );
+    word = (uint64_t)lo << 32 | hi;
+  }
+  else if( len )
+    word = (uint64_t)bytes[ 0 ] << 16 | (uint64_t)bytes[ len / 2 ] << 8 | bytes[ len - 1 ];
+
+  return (size_t)cc_hash_word( hash, word );
 }
 
-#elif SIZE_MAX == 0xFFFFFFFFFFFFFFFF // 64-bit size_t.
+#ifdef CC_NO_WORD_SCAN
 
 static inline size_t cc_hash_c_string( void *void_val )
 {
-    char *val = *(char **)void_val;
-    size_t hash = 0xcbf29ce484222325;
-    while( *val )
-      hash = ( (unsigned char)*val++ ^ hash ) * 0x100000001b3;
-
-    return hash;
+  char *val = *(char **)void_val;
+  return cc_hash_bytes( val, strlen( val ) );
 }
 
-#else // Strange size_t.
+#else
 
 static inline size_t cc_hash_c_string( void *void_val )
 {
-    char *val = *(char **)void_val;
-    size_t hash = 0;
-    while( *val )
-        hash = hash * 131 + (unsigned char)*val++;
+  const unsigned char *val = *(const unsigned char **)void_val;
+  uint64_t hash = 0xCBF29CE484222325ull;
+
+  for( ; ; val += 8 )
+  {
+    uint64_t word = 0;
+    uint64_t zeros = 0;
+
+    if( ( (uintptr_t)val & 4095 ) <= 4096 - 8 )
+    {
+      memcpy( &word, val, 8 );
+      zeros = ( word - 0x0101010101010101ull ) & ~word & 0x8080808080808080ull;
+    }
+    else
+      for( int i = 0; i < 8; ++i )
+      {
+        if( !val[ i ] )
+        {
+          zeros = 0x80ull << i * 8;
+          break;
+        }
+
+        word |= (uint64_t)val[ i ] << i * 8;
+      }
 
-    return hash;
+    if( zeros )
+    {
+      // Clear the bytes after the terminator, whose "zero byte" bits may be spurious.
+      word &= ( zeros & ( ~zeros + 1 ) ) - 1;
+      return (size_t)cc_hash_word( hash, word );
+    }
+
+    hash = cc_hash_word( hash, word );
+  }
 }
 
 #endif
@@ -4477,4 +11561,340 @@ const double CC_CAT_3( cc_load_, CC_N_LOADS, _val ) = CC_OTHER_ARGS( CC_LOAD );
 #undef CC_LOAD
 #endif
 
+#ifdef CC_MAX_PROBELEN
+
+typedef CC_TYPEOF_TY( CC_1ST_ARG( CC_MAX_PROBELEN ) ) CC_CAT_3( cc_max_probelen_, CC_N_MAX_PROBELENS, _ty );
+
+static const size_t CC_CAT_3( cc_max_probelen_, CC_N_MAX_PROBELENS, _val ) = CC_OTHER_ARGS( CC_MAX_PROBELEN );
+
+#if CC_N_MAX_PROBELENS_D1 == 0
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 1
+#elif CC_N_MAX_PROBELENS_D1 == 1
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 2
+#elif CC_N_MAX_PROBELENS_D1 == 2
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 3
+#elif CC_N_MAX_PROBELENS_D1 == 3
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 4
+#elif CC_N_MAX_PROBELENS_D1 == 4
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 5
+#elif CC_N_MAX_PROBELENS_D1 == 5
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 6
+#elif CC_N_MAX_PROBELENS_D1 == 6
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 7
+#elif CC_N_MAX_PROBELENS_D1 == 7
+#undef CC_N_MAX_PROBELENS_D1
+#define CC_N_MAX_PROBELENS_D1 0
+#if CC_N_MAX_PROBELENS_D2 == 0
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 1
+#elif CC_N_MAX_PROBELENS_D2 == 1
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 2
+#elif CC_N_MAX_PROBELENS_D2 == 2
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 3
+#elif CC_N_MAX_PROBELENS_D2 == 3
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 4
+#elif CC_N_MAX_PROBELENS_D2 == 4
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 5
+#elif CC_N_MAX_PROBELENS_D2 == 5
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 6
+#elif CC_N_MAX_PROBELENS_D2 == 6
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 7
+#elif CC_N_MAX_PROBELENS_D2 == 7
+#undef CC_N_MAX_PROBELENS_D2
+#define CC_N_MAX_PROBELENS_D2 0
+#if CC_N_MAX_PROBELENS_D3 == 0
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 1
+#elif CC_N_MAX_PROBELENS_D3 == 1
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 2
+#elif CC_N_MAX_PROBELENS_D3 == 2
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 3
+#elif CC_N_MAX_PROBELENS_D3 == 3
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 4
+#elif CC_N_MAX_PROBELENS_D3 == 4
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 5
+#elif CC_N_MAX_PROBELENS_D3 == 5
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 6
+#elif CC_N_MAX_PROBELENS_D3 == 6
+#undef CC_N_MAX_PROBELENS_D3
+#define CC_N_MAX_PROBELENS_D3 7
+#elif CC_N_MAX_PROBELENS_D3 == 7
+#error Sorry, number of max probe lengths is limited to 511.
+#endif
+#endif
+#endif
+
+#undef CC_MAX_PROBELEN
+#endif
+
+#ifdef CC_MIN_LOAD
+
+typedef CC_TYPEOF_TY( CC_1ST_ARG( CC_MIN_LOAD ) ) CC_CAT_3( cc_min_load_, CC_N_MIN_LOADS, _ty );
+
+static const double CC_CAT_3( cc_min_load_, CC_N_MIN_LOADS, _val ) = CC_OTHER_ARGS( CC_MIN_LOAD );
+
+#if CC_N_MIN_LOADS_D1 == 0
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 1
+#elif CC_N_MIN_LOADS_D1 == 1
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 2
+#elif CC_N_MIN_LOADS_D1 == 2
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 3
+#elif CC_N_MIN_LOADS_D1 == 3
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 4
+#elif CC_N_MIN_LOADS_D1 == 4
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 5
+#elif CC_N_MIN_LOADS_D1 == 5
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 6
+#elif CC_N_MIN_LOADS_D1 == 6
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 7
+#elif CC_N_MIN_LOADS_D1 == 7
+#undef CC_N_MIN_LOADS_D1
+#define CC_N_MIN_LOADS_D1 0
+#if CC_N_MIN_LOADS_D2 == 0
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 1
+#elif CC_N_MIN_LOADS_D2 == 1
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 2
+#elif CC_N_MIN_LOADS_D2 == 2
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 3
+#elif CC_N_MIN_LOADS_D2 == 3
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 4
+#elif CC_N_MIN_LOADS_D2 == 4
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 5
+#elif CC_N_MIN_LOADS_D2 == 5
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 6
+#elif CC_N_MIN_LOADS_D2 == 6
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 7
+#elif CC_N_MIN_LOADS_D2 == 7
+#undef CC_N_MIN_LOADS_D2
+#define CC_N_MIN_LOADS_D2 0
+#if CC_N_MIN_LOADS_D3 == 0
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 1
+#elif CC_N_MIN_LOADS_D3 == 1
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 2
+#elif CC_N_MIN_LOADS_D3 == 2
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 3
+#elif CC_N_MIN_LOADS_D3 == 3
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 4
+#elif CC_N_MIN_LOADS_D3 == 4
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 5
+#elif CC_N_MIN_LOADS_D3 == 5
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 6
+#elif CC_N_MIN_LOADS_D3 == 6
+#undef CC_N_MIN_LOADS_D3
+#define CC_N_MIN_LOADS_D3 7
+#elif CC_N_MIN_LOADS_D3 == 7
+#error Sorry, number of min load factors is limited to 511.
+#endif
+#endif
+#endif
+
+#undef CC_MIN_LOAD
+#endif
+
+#ifdef CC_GROWTH
+
+typedef CC_TYPEOF_TY( CC_1ST_ARG( CC_GROWTH ) ) CC_CAT_3( cc_growth_, CC_N_GROWTHS, _ty );
+
+static const cc_vec_growth_ty CC_CAT_3( cc_growth_, CC_N_GROWTHS, _val ) = { CC_OTHER_ARGS( CC_GROWTH ) };
+
+#if CC_N_GROWTHS_D1 == 0
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 1
+#elif CC_N_GROWTHS_D1 == 1
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 2
+#elif CC_N_GROWTHS_D1 == 2
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 3
+#elif CC_N_GROWTHS_D1 == 3
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 4
+#elif CC_N_GROWTHS_D1 == 4
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 5
+#elif CC_N_GROWTHS_D1 == 5
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 6
+#elif CC_N_GROWTHS_D1 == 6
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 7
+#elif CC_N_GROWTHS_D1 == 7
+#undef CC_N_GROWTHS_D1
+#define CC_N_GROWTHS_D1 0
+#if CC_N_GROWTHS_D2 == 0
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 1
+#elif CC_N_GROWTHS_D2 == 1
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 2
+#elif CC_N_GROWTHS_D2 == 2
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 3
+#elif CC_N_GROWTHS_D2 == 3
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 4
+#elif CC_N_GROWTHS_D2 == 4
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 5
+#elif CC_N_GROWTHS_D2 == 5
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 6
+#elif CC_N_GROWTHS_D2 == 6
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 7
+#elif CC_N_GROWTHS_D2 == 7
+#undef CC_N_GROWTHS_D2
+#define CC_N_GROWTHS_D2 0
+#if CC_N_GROWTHS_D3 == 0
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 1
+#elif CC_N_GROWTHS_D3 == 1
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 2
+#elif CC_N_GROWTHS_D3 == 2
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 3
+#elif CC_N_GROWTHS_D3 == 3
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 4
+#elif CC_N_GROWTHS_D3 == 4
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 5
+#elif CC_N_GROWTHS_D3 == 5
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 6
+#elif CC_N_GROWTHS_D3 == 6
+#undef CC_N_GROWTHS_D3
+#define CC_N_GROWTHS_D3 7
+#elif CC_N_GROWTHS_D3 == 7
+#error Sorry, number of growth policies is limited to 511.
+#endif
+#endif
+#endif
+
+#undef CC_GROWTH
+#endif
+
+#ifdef CC_FLAGS
+
+typedef CC_TYPEOF_TY( CC_1ST_ARG( CC_FLAGS ) ) CC_CAT_3( cc_flags_, CC_N_FLAGS, _ty );
+
+static const unsigned int CC_CAT_3( cc_flags_, CC_N_FLAGS, _val ) = CC_OTHER_ARGS( CC_FLAGS );
+
+#if CC_N_FLAGS_D1 == 0
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 1
+#elif CC_N_FLAGS_D1 == 1
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 2
+#elif CC_N_FLAGS_D1 == 2
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 3
+#elif CC_N_FLAGS_D1 == 3
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 4
+#elif CC_N_FLAGS_D1 == 4
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 5
+#elif CC_N_FLAGS_D1 == 5
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 6
+#elif CC_N_FLAGS_D1 == 6
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 7
+#elif CC_N_FLAGS_D1 == 7
+#undef CC_N_FLAGS_D1
+#define CC_N_FLAGS_D1 0
+#if CC_N_FLAGS_D2 == 0
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 1
+#elif CC_N_FLAGS_D2 == 1
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 2
+#elif CC_N_FLAGS_D2 == 2
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 3
+#elif CC_N_FLAGS_D2 == 3
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 4
+#elif CC_N_FLAGS_D2 == 4
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 5
+#elif CC_N_FLAGS_D2 == 5
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 6
+#elif CC_N_FLAGS_D2 == 6
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 7
+#elif CC_N_FLAGS_D2 == 7
+#undef CC_N_FLAGS_D2
+#define CC_N_FLAGS_D2 0
+#if CC_N_FLAGS_D3 == 0
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 1
+#elif CC_N_FLAGS_D3 == 1
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 2
+#elif CC_N_FLAGS_D3 == 2
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 3
+#elif CC_N_FLAGS_D3 == 3
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 4
+#elif CC_N_FLAGS_D3 == 4
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 5
+#elif CC_N_FLAGS_D3 == 5
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 6
+#elif CC_N_FLAGS_D3 == 6
+#undef CC_N_FLAGS_D3
+#define CC_N_FLAGS_D3 7
+#elif CC_N_FLAGS_D3 == 7
+#error Sorry, number of flag sets is limited to 511.
+#endif
+#endif
+#endif
+
+#undef CC_FLAGS
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,161 @@
+// Regression test for incremental migrations that stop short under CC_SMALL_PROBELEN.
+// The first 200 keys below share one hash, and every other key hashes to a multiple of 4096, so all keys collide in
+// tables of up to 4096 buckets and a migration into such a table pauses once its probe lengths reach
+// CC_MAP_PROBELEN_LIMIT.
+// Build and run with e.g.:
+//   cc -std=c11 -fsanitize=address,undefined tests/map_paused_migration.c -o map_paused_migration
+//   ./map_paused_migration
+
+#include <stdio.h>
+
+#define CC_SMALL_PROBELEN
+#include "../cc.h"
+
+typedef struct
+{
+  unsigned int val;
+} colliding_key;
+
+#define CC_CMPR colliding_key, { return val_1.val < val_2.val ? -1 : val_1.val > val_2.val; }
+#define CC_HASH colliding_key, { return val.val < 200 ? 0 : (size_t)val.val * 4096; }
+#define CC_LOAD colliding_key, 0.95
+#define CC_FLAGS colliding_key, CC_INCREMENTAL
+#define CC_MIN_LOAD colliding_key, 0.3
+#define CC_MAX_PROBELEN colliding_key, 3
+#include "../cc.h"
+
+#define CHECK( cond )                                                  \
+do                                                                     \
+{                                                                      \
+  if( !( cond ) )                                                      \
+  {                                                                    \
+    printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond );  \
+    return 1;                                                          \
+  }                                                                    \
+} while( 0 )                                                           \
+
+static bool always( const colliding_key *key, int *el )
+{
+  (void)key;
+  (void)el;
+  return true;
+}
+
+static bool every_third( const colliding_key *key, int *el )
+{
+  (void)el;
+  return key->val % 3 == 1;
+}
+
+// Inserts keys 0 to n - 1, which leaves the growth migration paused for n between 255 and 258.
+static bool fill( map( colliding_key, int ) *m, unsigned int n )
+{
+  for( unsigned int i = 0; i < n; ++i )
+    if( !insert( m, (colliding_key){ i }, (int)i ) )
+      return false;
+
+  return size( m ) == n;
+}
+
+// Insertions that grow a map while a migration is paused must not lose the elements remaining in its old table.
+static int test_insert( void )
+{
+  for( unsigned int n = 255; n <= 258; ++n )
+  {
+    map( colliding_key, int ) m;
+    init( &m );
+    CHECK( fill( &m, n ) );
+
+    size_t expected_size = n;
+    for( unsigned int i = 1000; i < 1200; ++i )
+    {
+      if( insert( &m, (colliding_key){ i }, (int)i ) )
+        ++expected_size;
+
+      CHECK( size( &m ) == expected_size );
+    }
+
+    for( unsigned int i = 0; i < n; ++i )
+    {
+      int *el = get( &m, (colliding_key){ i } );
+      CHECK( el && *el == (int)i );
+    }
+
+    cleanup( &m );
+  }
+
+  return 0;
+}
+
+// erase_if must also filter the elements remaining in the old table.
+static int test_erase_if( void )
+{
+  for( unsigned int n = 255; n <= 258; ++n )
+  {
+    map( colliding_key, int ) m;
+    init( &m );
+    CHECK( fill( &m, n ) );
+
+    size_t expected_size = 0;
+    for( unsigned int i = 0; i < n; ++i )
+      expected_size += i % 3 != 1;
+
+    CHECK( erase_if( &m, every_third ) == n - expected_size );
+    CHECK( size( &m ) == expected_size );
+
+    for( unsigned int i = 0; i < n; ++i )
+    {
+      int *el = get( &m, (colliding_key){ i } );
+      CHECK( i % 3 == 1 ? !el : el && *el == (int)i );
+    }
+
+    size_t n_iterated = 0;
+    for_each( &m, key, el )
+    {
+      CHECK( *el == (int)key->val );
+      ++n_iterated;
+    }
+    CHECK( n_iterated == expected_size );
+
+    CHECK( erase_if( &m, always ) == expected_size );
+    CHECK( size( &m ) == 0 );
+
+    cleanup( &m );
+  }
+
+  return 0;
+}
+
+// A shrink triggered by the min load factor must not start a migration that cannot finish.
+// Every smaller table would exceed the probe length limit, so the shrink fails and leaves the capacity unchanged.
+static int test_auto_shrink( void )
+{
+  map( colliding_key, int ) m;
+  init( &m );
+  CHECK( fill( &m, 400 ) );
+
+  size_t cap_before = cap( &m );
+  for( unsigned int i = 0; i < 20; ++i )
+    CHECK( erase( &m, (colliding_key){ i } ) );
+
+  CHECK( cap( &m ) == cap_before );
+  CHECK( size( &m ) == 380 );
+
+  for( unsigned int i = 20; i < 400; ++i )
+  {
+    int *el = get( &m, (colliding_key){ i } );
+    CHECK( el && *el == (int)i );
+  }
+
+  cleanup( &m );
+  return 0;
+}
+
+int main( void )
+{
+  if( test_insert() || test_erase_if() || test_auto_shrink() )
+    return 1;
+
+  puts( "All tests passed." );
+  return 0;
+}